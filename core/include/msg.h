@@ -310,6 +310,45 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Send multiple messages to a thread in one go.
+ *
+ * All messages are handed over within a single critical section. If the
+ * target thread is waiting for a message, the first message is copied to it
+ * directly, all following messages are appended to the target's message
+ * queue. The target is woken up (and a context switch is triggered) at most
+ * once, no matter how many messages were delivered.
+ *
+ * This function never blocks: if the message queue of the target runs full,
+ * delivery stops and the number of messages handed over so far is returned.
+ * It can be called from thread and from interrupt context.
+ *
+ * @param[in] m             Array of @p num preallocated ``msg_t`` structures
+ * @param[in] num           Number of messages in @p m
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  number of messages delivered, in order, starting with `m[0]`
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
+/**
+ * @brief Receive multiple messages at once.
+ *
+ * Takes up to @p num messages out of the message queue of the calling thread
+ * (and from threads blocked sending to it) within a single critical section.
+ * Senders that get unblocked are woken up with a single context switch.
+ *
+ * If no message is available, this function blocks until a message is
+ * received. In that case only a single message is returned.
+ *
+ * @param[out] m    Array of at least @p num preallocated ``msg_t`` structures
+ * @param[in] num   Maximum number of messages to receive, must not be 0
+ *
+ * @return  number of messages written to @p m (at least 1)
+ */
+int msg_receive_batch(msg_t *m, unsigned num);
+
 /**
  * @brief Send a message, block until reply received.
  *
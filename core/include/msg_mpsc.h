@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_msg
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free multi-producer single-consumer message queue
+ *
+ * A thread can use this queue instead of the default @ref cib_t based message
+ * queue by initializing it with @ref msg_init_queue_mpsc() instead of
+ * @ref msg_init_queue(). Messages are then added to the queue using atomic
+ * compare-and-swap on the write position instead of disabling interrupts, so
+ * that senders (threads and ISRs) do not need to enter a critical section
+ * unless the receiving thread has to be woken up.
+ *
+ * The queue is a bounded array of slots, each carrying a sequence number that
+ * tells whether the slot is ready to be written or to be read. Only the
+ * thread owning the queue reads from it.
+ *
+ * @note    A sender that got preempted after reserving a slot, but before
+ *          filling it, delays delivery of all messages queued after it until
+ *          it gets scheduled again.
+ *
+ * This is provided by the `core_msg_mpsc` module.
+ */
+
+#ifndef MSG_MPSC_H
+#define MSG_MPSC_H
+
+#include <stdbool.h>
+#ifdef __cplusplus
+#include "c11_atomics_compat.hpp"
+#else
+#include <stdatomic.h>
+#endif
+
+#include "msg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   A single slot of a @ref msg_mpsc_t
+ */
+typedef struct {
+    msg_t msg;                  /**< message stored in this slot */
+    atomic_uint seq;            /**< sequence number of the slot */
+} msg_mpsc_slot_t;
+
+/**
+ * @brief   Lock-free multi-producer single-consumer message queue
+ */
+typedef struct msg_mpsc {
+    msg_mpsc_slot_t *slots;     /**< array of slots */
+    atomic_uint tail;           /**< next position to claim by a producer */
+    unsigned head;              /**< next position to read by the consumer */
+    unsigned mask;              /**< number of slots minus one */
+} msg_mpsc_t;
+
+/**
+ * @brief   Initialize the current thread's message queue as lock-free
+ *          multi-producer single-consumer queue.
+ *
+ * This is a drop-in replacement for @ref msg_init_queue(): all message API
+ * functions work the same on a thread using this queue.
+ *
+ * @pre @p num **MUST BE A POWER OF TWO!**
+ *
+ * @param[out] queue    Queue to initialize, must stay valid for the lifetime
+ *                      of the thread
+ * @param[in] slots     Pointer to preallocated array of slots
+ * @param[in] num       Number of slots in @p slots, **MUST BE POWER OF TWO!**
+ */
+void msg_init_queue_mpsc(msg_mpsc_t *queue, msg_mpsc_slot_t *slots,
+                         unsigned num);
+
+/**
+ * @brief   Add a message to the queue
+ *
+ * May be called concurrently from any context.
+ *
+ * @param[in] queue     Queue to add the message to
+ * @param[in] m         Message to add
+ *
+ * @retval  true        @p m was added to the queue
+ * @retval  false       the queue is full
+ */
+bool msg_mpsc_put(msg_mpsc_t *queue, const msg_t *m);
+
+/**
+ * @brief   Take the oldest message out of the queue
+ *
+ * @pre     Must only be called by a single consumer at a time
+ *
+ * @param[in] queue     Queue to read from
+ * @param[out] m        Message taken out of the queue
+ *
+ * @retval  true        @p m was filled
+ * @retval  false       no (completely written) message is in the queue
+ */
+bool msg_mpsc_get(msg_mpsc_t *queue, msg_t *m);
+
+/**
+ * @brief   Get the number of messages in the queue
+ *
+ * The result also counts slots that were reserved by a producer but are not
+ * completely written yet.
+ *
+ * @param[in] queue     Queue to check
+ *
+ * @return  number of messages in the queue
+ */
+static inline unsigned msg_mpsc_avail(msg_mpsc_t *queue)
+{
+    return atomic_load_explicit(&queue->tail, memory_order_relaxed)
+           - queue->head;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSG_MPSC_H */
+/** @} */
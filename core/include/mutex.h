@@ -91,6 +91,23 @@
  *       `MUTEX_LOCK`.
  *     - The scheduler is run, so that if the unblocked waiting thread can
  *       run now, in case it has a higher priority than the running thread.
+ *
+ * Priority Inheritance
+ * --------------------
+ *
+ * When the (pseudo-)module `core_mutex_priority_inheritance` is used, the
+ * mutex additionally tracks its owner. If a thread blocks on a mutex owned by
+ * a thread of lower priority, the owner temporarily runs with the priority of
+ * the blocked thread, so that threads of medium priority cannot delay the
+ * high priority thread by preempting the owner (priority inversion). The
+ * priority of the owner is lowered again on `mutex_unlock()`, as far as no
+ * other mutex still held by the owner has a waiter of higher priority.
+ *
+ * Mutexes locked before the scheduler started or from ISR context have no
+ * owner and thus do not boost anyone.
+ *
+ * Inheritance is not transitive: if the owner is itself blocked on another
+ * mutex, the owner of that mutex is not boosted.
  * @{
  *
  * @file
@@ -127,6 +144,15 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The current owner of the mutex or `KERNEL_PID_UNDEF`
+     * @note    Only available if module core_mutex_priority_inheritance
+     *          is used.
+     * @internal
+     */
+    kernel_pid_t owner;
+#endif
 } mutex_t;
 
 /**
@@ -141,16 +167,21 @@ typedef struct {
     uint8_t cancelled;  /**< Flag whether the mutex has been cancelled */
 } mutex_cancel_t;
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
-#define MUTEX_INIT { { NULL } }
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF }
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF }
+#else
+#define MUTEX_INIT { { NULL } }
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @cond INTERNAL
@@ -171,6 +202,9 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+#endif
 }
 
 /**
@@ -232,6 +266,13 @@ static inline int mutex_trylock(mutex_t *mutex)
     if (mutex->queue.next == NULL) {
         mutex->queue.next = MUTEX_LOCKED;
         retval = 1;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        /* there is no thread to boost before the scheduler started or when
+         * called from ISR context */
+        thread_t *me = thread_get_active();
+        mutex->owner = ((me != NULL) && !irq_is_in()) ? me->pid
+                                                      : KERNEL_PID_UNDEF;
+#endif
     }
     irq_restore(irq_state);
     return retval;
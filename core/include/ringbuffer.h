@@ -160,6 +160,39 @@ int ringbuffer_peek_one(const ringbuffer_t *__restrict rb);
 unsigned ringbuffer_peek(const ringbuffer_t *__restrict rb, char *buf,
                          unsigned n);
 
+/**
+ * @brief           Get the contiguous free space at the write position.
+ * @details         Allows filling the ringbuffer in place (e.g. by DMA).
+ *                  The written data gets added with ringbuffer_commit().
+ *                  As the free space may wrap around, up to two spans may be
+ *                  needed to fill the ringbuffer.
+ * @param[in]       rb    Ringbuffer to operate on.
+ * @param[out]      buf   Start of the free region.
+ * @returns         Size of the region at @p buf, 0 iff full.
+ */
+unsigned ringbuffer_get_write_span(ringbuffer_t *__restrict rb, char **buf);
+
+/**
+ * @brief           Add elements written into a write span to the ringbuffer.
+ * @pre             @p n is not larger than the size returned by the last
+ *                  call to ringbuffer_get_write_span().
+ * @param[in,out]   rb    Ringbuffer to operate on.
+ * @param[in]       n     Number of elements written.
+ */
+void ringbuffer_commit(ringbuffer_t *__restrict rb, unsigned n);
+
+/**
+ * @brief           Get the contiguous data at the read position.
+ * @details         The data is not removed, use ringbuffer_remove() once it
+ *                  was processed. As the data may wrap around, up to two
+ *                  spans may be needed to drain the ringbuffer.
+ * @param[in]       rb    Ringbuffer to operate on.
+ * @param[out]      buf   Start of the data.
+ * @returns         Number of elements at @p buf, 0 iff empty.
+ */
+unsigned ringbuffer_peek_read_span(const ringbuffer_t *__restrict rb,
+                                   const char **buf);
+
 #ifdef __cplusplus
 }
 #endif
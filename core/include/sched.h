@@ -278,6 +278,124 @@ typedef void (*sched_callback_t)(kernel_pid_t active, kernel_pid_t next);
 void sched_register_cb(sched_callback_t callback);
 #endif /* MODULE_SCHED_CB */
 
+#if IS_USED(MODULE_SCHED_EDF) || defined(DOXYGEN)
+/**
+ * @brief   Put a thread into the earliest-deadline-first class
+ *
+ * Within the runqueue of a priority level, threads with a deadline are
+ * scheduled before threads without one, ordered by their deadline. A thread
+ * that gets runnable and has an earlier deadline than the running thread of
+ * the same priority preempts it.
+ *
+ * Deadlines are absolute time stamps of an arbitrary free running 32 bit
+ * clock, the scheduler only compares them (taking overflows into account).
+ * Use @ref thread_set_deadline() of the `sched_edf` module to set deadlines
+ * relative to the current time.
+ *
+ * @note    @ref thread_yield() moves the calling thread behind all other
+ *          threads of its priority, regardless of their deadlines.
+ *
+ * @param[in,out] thread    Thread to set the deadline for
+ * @param[in] deadline      Absolute deadline
+ */
+void sched_set_deadline(thread_t *thread, uint32_t deadline);
+
+/**
+ * @brief   Remove a thread from the earliest-deadline-first class
+ *
+ * The thread keeps its position in the runqueue, a running thread keeps
+ * running.
+ *
+ * @param[in,out] thread    Thread to clear the deadline of
+ */
+void sched_clear_deadline(thread_t *thread);
+
+/**
+ * @brief   Hook called when a thread exits
+ *
+ * Called by @ref sched_task_exit() with interrupts disabled, before the
+ * thread is removed. Implemented by the `sched_edf` module to disarm the
+ * deadline timer of the thread.
+ *
+ * @warning This API is not intended for out of tree users.
+ *
+ * @param   pid     The exiting thread
+ */
+void sched_exit_callback(kernel_pid_t pid);
+#endif /* MODULE_SCHED_EDF */
+
+/**
+ * @brief   Change the priority of a thread
+ *
+ * If the thread is on a runqueue, it is moved to the runqueue of the new
+ * priority the same way @ref sched_set_status() adds threads to it. The
+ * running thread is kept at the front of its new runqueue. This does not
+ * trigger a context switch, use @ref sched_switch() if needed.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param[in,out] thread    The thread to change the priority of
+ * @param[in] priority      The new priority
+ */
+void sched_change_priority(thread_t *thread, uint8_t priority);
+
+#if IS_USED(MODULE_SCHED_ROUND_ROBIN) || defined(DOXYGEN)
+/**
+ * @brief   Hook called when the runqueue of a priority changed
+ *
+ * Called by the scheduler with interrupts disabled whenever a thread got
+ * added to or removed from the runqueue of @p prio, and whenever a thread of
+ * priority @p prio got scheduled to run. Implemented by the
+ * `sched_round_robin` module.
+ *
+ * @warning This API is not intended for out of tree users.
+ *
+ * @param   prio      The priority of the runqueue that changed
+ */
+void sched_runq_callback(uint8_t prio);
+#endif /* MODULE_SCHED_ROUND_ROBIN */
+
+/**
+ * @brief   Kernel events passed to @ref sched_trace_callback()
+ */
+typedef enum {
+    SCHED_TRACE_SWITCH = 1,         /**< context switch */
+    SCHED_TRACE_MSG_SEND,           /**< message sent or replied */
+    SCHED_TRACE_MSG_RECV,           /**< message received */
+    SCHED_TRACE_MUTEX_BLOCK,        /**< thread blocked on a mutex */
+    SCHED_TRACE_MUTEX_UNBLOCK,      /**< thread got the mutex handed over */
+    SCHED_TRACE_THREAD_FLAGS_SET,   /**< thread flags set */
+    SCHED_TRACE_THREAD_FLAGS_WAIT,  /**< thread blocked on thread flags */
+} sched_trace_event_t;
+
+#if IS_USED(MODULE_TRACE_EVENT) || defined(DOXYGEN)
+/**
+ * @brief   Hook called on context switches, IPC and mutex hand-overs
+ *
+ * Called by the kernel, often with interrupts disabled and from within
+ * @ref sched_run(). Implemented by the `trace_event` module, an empty inline
+ * function otherwise.
+ *
+ * @warning This API is not intended for out of tree users.
+ *
+ * @param   event   The event
+ * @param   pid     Thread the event refers to
+ * @param   arg     Event specific argument
+ */
+void sched_trace_callback(sched_trace_event_t event, kernel_pid_t pid,
+                          uint32_t arg);
+#else
+static inline void sched_trace_callback(sched_trace_event_t event,
+                                        kernel_pid_t pid, uint32_t arg)
+{
+    (void)event;
+    (void)pid;
+    (void)arg;
+}
+#endif /* MODULE_TRACE_EVENT */
+
 /**
  * @brief   Advance a runqueue
  *
@@ -179,6 +179,17 @@ struct _thread {
 
     clist_node_t rq_entry;          /**< run queue entry                */
 
+#if defined(MODULE_SCHED_EDF) || defined(DOXYGEN)
+    uint32_t deadline;              /**< absolute deadline, only valid if
+                                         thread_t::has_deadline is set  */
+    uint8_t has_deadline;           /**< thread is in the EDF class     */
+#endif
+
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    uint8_t base_priority;          /**< priority without inheritance   */
+    void *mutex_waiting;            /**< mutex the thread is blocked on */
+#endif
+
 #if defined(MODULE_CORE_MSG) || defined(MODULE_CORE_THREAD_FLAGS) \
     || defined(MODULE_CORE_MBOX) || defined(DOXYGEN)
     void *wait_data;                /**< used by msg, mbox and thread
@@ -193,6 +204,11 @@ struct _thread {
     msg_t *msg_array;               /**< memory holding messages sent
                                          to this thread's message queue */
 #endif
+#if defined(MODULE_CORE_MSG_MPSC) || defined(DOXYGEN)
+    struct msg_mpsc *msg_mpsc;      /**< lock-free message queue used
+                                         instead of thread_t::msg_array,
+                                         if any                         */
+#endif
 #if defined(DEVELHELP) || defined(SCHED_TEST_STACK) \
     || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
@@ -488,6 +504,11 @@ void thread_print_stack(void);
  */
 static inline int thread_has_msg_queue(const volatile struct _thread *thread)
 {
+#if defined(MODULE_CORE_MSG_MPSC)
+    if (thread->msg_mpsc != NULL) {
+        return 1;
+    }
+#endif
 #if defined(MODULE_CORE_MSG) || defined(DOXYGEN)
     return (thread->msg_array != NULL);
 #else
@@ -33,6 +33,10 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#if MODULE_CORE_MSG_MPSC
+#include "atomic_utils.h"
+#include "msg_mpsc.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -41,19 +45,52 @@ static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
 
-static int queue_msg(thread_t *target, const msg_t *m)
+/* adds @p m to the message queue of @p target without waking it up */
+static int _queue_put(thread_t *target, const msg_t *m)
 {
+#if MODULE_CORE_MSG_MPSC
+    if (target->msg_mpsc != NULL) {
+        return msg_mpsc_put(target->msg_mpsc, m);
+    }
+#endif
+
     int n = cib_put(&(target->msg_queue));
 
     if (n < 0) {
+        return 0;
+    }
+
+    target->msg_array[n] = *m;
+    return 1;
+}
+
+/* takes the oldest message out of the message queue of @p me */
+static int _queue_get(thread_t *me, msg_t *m)
+{
+#if MODULE_CORE_MSG_MPSC
+    if (me->msg_mpsc != NULL) {
+        return msg_mpsc_get(me->msg_mpsc, m);
+    }
+#endif
+
+    int n = cib_get(&(me->msg_queue));
+
+    if (n < 0) {
+        return 0;
+    }
+
+    *m = me->msg_array[n];
+    return 1;
+}
+
+static int queue_msg(thread_t *target, const msg_t *m)
+{
+    if (!_queue_put(target, m)) {
         DEBUG("queue_msg(): message queue is full (or there is none)\n");
         return 0;
     }
 
     DEBUG("queue_msg(): queuing message\n");
-    msg_t *dest = &target->msg_array[n];
-
-    *dest = *m;
 #if MODULE_CORE_THREAD_FLAGS
     target->flags |= THREAD_FLAG_MSG_WAITING;
     thread_flags_wake(target);
@@ -61,14 +98,76 @@ static int queue_msg(thread_t *target, const msg_t *m)
     return 1;
 }
 
+#if MODULE_CORE_MSG_MPSC
+/* Delivers @p m to a thread using a msg_mpsc_t queue without disabling
+ * interrupts. A critical section is only entered if the target is blocked
+ * and may need to be woken up. Returns 0 if the message was not delivered,
+ * in which case the regular code path has to handle it. */
+static int _msg_send_mpsc(msg_t *m, kernel_pid_t target_pid, bool in_irq)
+{
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if ((target == NULL) || (target->msg_mpsc == NULL)) {
+        return 0;
+    }
+
+    m->sender_pid = (in_irq ? KERNEL_PID_ISR : thread_getpid());
+
+    if (!msg_mpsc_put(target->msg_mpsc, m)) {
+        return 0;
+    }
+
+    DEBUG("%s: queued message lock-free to %" PRIkernel_pid "\n",
+          __func__, target_pid);
+
+#if MODULE_CORE_THREAD_FLAGS
+    atomic_fetch_or_u16(&target->flags, THREAD_FLAG_MSG_WAITING);
+#endif
+
+    /* the message has to be published before the state of the target is
+     * checked: a target that is about to block will see the message, a target
+     * that is already blocked is woken up below */
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (target->status >= STATUS_ON_RUNQUEUE) {
+        return 1;
+    }
+
+    unsigned state = irq_disable();
+
+    if ((target->status == STATUS_RECEIVE_BLOCKED)
+        && msg_mpsc_get(target->msg_mpsc, target->wait_data)) {
+        sched_set_status(target, STATUS_PENDING);
+        sched_context_switch_request = 1;
+    }
+#if MODULE_CORE_THREAD_FLAGS
+    thread_flags_wake(target);
+#endif
+
+    irq_restore(state);
+
+    if (sched_context_switch_request && !in_irq) {
+        thread_yield_higher();
+    }
+
+    return 1;
+}
+#endif /* MODULE_CORE_MSG_MPSC */
+
 int msg_send(msg_t *m, kernel_pid_t target_pid)
 {
     if (irq_is_in()) {
         return msg_send_int(m, target_pid);
     }
+    sched_trace_callback(SCHED_TRACE_MSG_SEND, target_pid, m->type);
     if (thread_getpid() == target_pid) {
         return msg_send_to_self(m);
     }
+#if MODULE_CORE_MSG_MPSC
+    if (_msg_send_mpsc(m, target_pid, false)) {
+        return 1;
+    }
+#endif
     return _msg_send(m, target_pid, true, irq_disable());
 }
 
@@ -77,9 +176,15 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid)
     if (irq_is_in()) {
         return msg_send_int(m, target_pid);
     }
+    sched_trace_callback(SCHED_TRACE_MSG_SEND, target_pid, m->type);
     if (thread_getpid() == target_pid) {
         return msg_send_to_self(m);
     }
+#if MODULE_CORE_MSG_MPSC
+    if (_msg_send_mpsc(m, target_pid, false)) {
+        return 1;
+    }
+#endif
     return _msg_send(m, target_pid, false, irq_disable());
 }
 
@@ -229,6 +334,14 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
 {
     int res;
 
+    sched_trace_callback(SCHED_TRACE_MSG_SEND, target_pid, m->type);
+
+#if MODULE_CORE_MSG_MPSC
+    if (_msg_send_mpsc(m, target_pid, true)) {
+        return 1;
+    }
+#endif
+
     m->sender_pid = KERNEL_PID_ISR;
 
     res = _msg_send_oneway(m, target_pid);
@@ -255,6 +368,8 @@ int msg_send_bus(msg_t *m, msg_bus_t *bus)
         }
 
         if (_msg_send_oneway(m, subscriber->pid) > 0) {
+            sched_trace_callback(SCHED_TRACE_MSG_SEND, subscriber->pid,
+                                 m->type);
             ++count;
         }
     }
@@ -268,9 +383,64 @@ int msg_send_bus(msg_t *m, msg_bus_t *bus)
     return count;
 }
 
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender_pid = (in_irq ? KERNEL_PID_ISR : thread_getpid());
+    unsigned n = 0;
+
+    unsigned state = irq_disable();
+
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if (target == NULL) {
+        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
+              PRIkernel_pid ".\n", __func__, sender_pid, target_pid);
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        sched_context_switch_request = 1;
+        n++;
+    }
+
+    for (; n < num; n++) {
+        m[n].sender_pid = sender_pid;
+        if (!_queue_put(target, &m[n])) {
+            DEBUG("%s: message queue is full (or there is none)\n", __func__);
+            break;
+        }
+    }
+
+#if MODULE_CORE_THREAD_FLAGS
+    if (n > 0) {
+        target->flags |= THREAD_FLAG_MSG_WAITING;
+        thread_flags_wake(target);
+    }
+#endif
+
+    for (unsigned i = 0; i < n; i++) {
+        sched_trace_callback(SCHED_TRACE_MSG_SEND, target_pid, m[i].type);
+    }
+
+    irq_restore(state);
+
+    if (sched_context_switch_request && !in_irq) {
+        thread_yield_higher();
+    }
+
+    return n;
+}
+
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(thread_getpid() != target_pid);
+    sched_trace_callback(SCHED_TRACE_MSG_SEND, target_pid, m->type);
     unsigned state = irq_disable();
     thread_t *me = thread_get_active();
 
@@ -281,7 +451,13 @@ int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
      * overwritten if the target is not in RECEIVE_BLOCKED */
     *reply = *m;
     /* msg_send blocks until reply received */
-    return _msg_send(reply, target_pid, true, state);
+    int res = _msg_send(reply, target_pid, true, state);
+
+    if (res > 0) {
+        sched_trace_callback(SCHED_TRACE_MSG_RECV, reply->sender_pid,
+                             reply->type);
+    }
+    return res;
 }
 
 int msg_reply(msg_t *m, msg_t *reply)
@@ -302,6 +478,7 @@ int msg_reply(msg_t *m, msg_t *reply)
 
     DEBUG("msg_reply(): %" PRIkernel_pid ": Direct msg copy.\n",
           thread_getpid());
+    sched_trace_callback(SCHED_TRACE_MSG_SEND, target->pid, reply->type);
     /* copy msg to target */
     msg_t *target_message = (msg_t *)target->wait_data;
 
@@ -326,6 +503,7 @@ int msg_reply_int(msg_t *m, msg_t *reply)
         return -1;
     }
 
+    sched_trace_callback(SCHED_TRACE_MSG_SEND, target->pid, reply->type);
     msg_t *target_message = (msg_t *)target->wait_data;
 
     *target_message = *reply;
@@ -336,14 +514,82 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res > 0) {
+        sched_trace_callback(SCHED_TRACE_MSG_RECV, m->sender_pid, m->type);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    sched_trace_callback(SCHED_TRACE_MSG_RECV, m->sender_pid, m->type);
+    return res;
 }
 
+#if MODULE_CORE_MSG_MPSC
+static int _msg_receive_mpsc(thread_t *me, msg_t *m, int block,
+                             unsigned state)
+{
+    thread_t *sender = NULL;
+
+    if (msg_mpsc_get(me->msg_mpsc, m)) {
+        /* a slot got freed, move the message of a blocked sender into it */
+        if (me->msg_waiters.next != NULL) {
+            sender = container_of((clist_node_t *)me->msg_waiters.next,
+                                  thread_t, rq_entry);
+            if (msg_mpsc_put(me->msg_mpsc, sender->wait_data)) {
+                list_remove_head(&me->msg_waiters);
+            }
+            else {
+                /* slot got claimed by a lock-free sender in the meantime,
+                 * the blocked sender stays in the waiting list */
+                sender = NULL;
+            }
+        }
+    }
+    else if (me->msg_waiters.next != NULL) {
+        sender = container_of((clist_node_t *)list_remove_head(&me->msg_waiters),
+                              thread_t, rq_entry);
+        *m = *((msg_t *)sender->wait_data);
+    }
+    else if (!block) {
+        irq_restore(state);
+        return -1;
+    }
+    else {
+        DEBUG("%s: %" PRIkernel_pid ": No msg in queue. Going blocked.\n",
+              __func__, thread_getpid());
+        me->wait_data = (void *)m;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied message */
+        assert(thread_get_active()->status != STATUS_RECEIVE_BLOCKED);
+        return 1;
+    }
+
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+
+    if ((sender != NULL) && (sender->status != STATUS_REPLY_BLOCKED)) {
+        sender->wait_data = NULL;
+        sched_set_status(sender, STATUS_PENDING);
+        sender_prio = sender->priority;
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+    return 1;
+}
+#endif /* MODULE_CORE_MSG_MPSC */
+
 static int _msg_receive(msg_t *m, int block)
 {
     unsigned state = irq_disable();
@@ -353,6 +599,12 @@ static int _msg_receive(msg_t *m, int block)
 
     thread_t *me = thread_get_active();
 
+#if MODULE_CORE_MSG_MPSC
+    if (me->msg_mpsc != NULL) {
+        return _msg_receive_mpsc(me, m, block, state);
+    }
+#endif
+
     int queue_index = -1;
 
     if (thread_has_msg_queue(me)) {
@@ -433,6 +685,72 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+int msg_receive_batch(msg_t *m, unsigned num)
+{
+    assert(num > 0);
+
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    uint16_t wake_prio = THREAD_PRIORITY_IDLE;
+    unsigned n = 0;
+
+    /* queued messages were sent first, so they are handed out first */
+    if (thread_has_msg_queue(me)) {
+        while ((n < num) && _queue_get(me, &m[n])) {
+            n++;
+        }
+    }
+
+    while (n < num) {
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+
+        if (next == NULL) {
+            break;
+        }
+
+        thread_t *sender =
+            container_of((clist_node_t *)next, thread_t, rq_entry);
+
+        m[n++] = *((msg_t *)sender->wait_data);
+
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < wake_prio) {
+                wake_prio = sender->priority;
+            }
+        }
+    }
+
+    if (n == 0) {
+        DEBUG("%s: %" PRIkernel_pid ": No msg available. Going blocked.\n",
+              __func__, thread_getpid());
+        me->wait_data = (void *)m;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied message */
+        assert(thread_get_active()->status != STATUS_RECEIVE_BLOCKED);
+        sched_trace_callback(SCHED_TRACE_MSG_RECV, m[0].sender_pid, m[0].type);
+        return 1;
+    }
+
+    irq_restore(state);
+
+    for (unsigned i = 0; i < n; i++) {
+        sched_trace_callback(SCHED_TRACE_MSG_RECV, m[i].sender_pid, m[i].type);
+    }
+
+    /* a single switch for all senders that got unblocked */
+    if (wake_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(wake_prio);
+    }
+
+    return n;
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -442,6 +760,12 @@ int msg_avail(void)
 
     int queue_index = -1;
 
+#if MODULE_CORE_MSG_MPSC
+    if (me->msg_mpsc != NULL) {
+        return msg_mpsc_avail(me->msg_mpsc);
+    }
+#endif
+
     if (thread_has_msg_queue(me)) {
         queue_index = cib_avail(&(me->msg_queue));
     }
@@ -455,6 +779,9 @@ void msg_init_queue(msg_t *array, int num)
 
     me->msg_array = array;
     cib_init(&(me->msg_queue), num);
+#if MODULE_CORE_MSG_MPSC
+    me->msg_mpsc = NULL;
+#endif
 }
 
 void msg_queue_print(void)
@@ -469,6 +796,16 @@ void msg_queue_print(void)
         printf("No message queue\n");
         return;
     }
+#if MODULE_CORE_MSG_MPSC
+    if (thread->msg_mpsc != NULL) {
+        printf("Lock-free message queue of thread %" PRIkernel_pid "\n",
+               thread->pid);
+        printf("    size: %u (avail: %d)\n", thread->msg_mpsc->mask + 1,
+               msg_counter);
+        irq_restore(state);
+        return;
+    }
+#endif
     cib_t *msg_queue = &thread->msg_queue;
     msg_t *msg_array = thread->msg_array;
     int first_msg = cib_peek(msg_queue);
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_msg
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free multi-producer single-consumer message queue
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "msg_mpsc.h"
+#include "thread.h"
+
+void msg_init_queue_mpsc(msg_mpsc_t *queue, msg_mpsc_slot_t *slots,
+                         unsigned num)
+{
+    /* make sure size is a power of two */
+    assert((num > 0) && !(num & (num - 1)));
+
+    queue->slots = slots;
+    queue->head = 0;
+    queue->mask = num - 1;
+    atomic_init(&queue->tail, 0);
+    for (unsigned i = 0; i < num; i++) {
+        atomic_init(&slots[i].seq, i);
+    }
+
+    thread_t *me = thread_get_active();
+
+    me->msg_array = NULL;
+    me->msg_mpsc = queue;
+}
+
+bool msg_mpsc_put(msg_mpsc_t *queue, const msg_t *m)
+{
+    unsigned pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    msg_mpsc_slot_t *slot;
+
+    while (1) {
+        slot = &queue->slots[pos & queue->mask];
+        unsigned seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        int diff = (int)(seq - pos);
+
+        if (diff == 0) {
+            /* slot is free, try to claim it */
+            if (atomic_compare_exchange_weak_explicit(&queue->tail, &pos,
+                                                      pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+            /* pos got updated with the current tail, retry */
+        }
+        else if (diff < 0) {
+            /* slot still holds a message that was not consumed: full */
+            return false;
+        }
+        else {
+            /* another producer claimed this slot, catch up */
+            pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        }
+    }
+
+    slot->msg = *m;
+    /* publish the slot to the consumer */
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+
+    return true;
+}
+
+bool msg_mpsc_get(msg_mpsc_t *queue, msg_t *m)
+{
+    unsigned pos = queue->head;
+    msg_mpsc_slot_t *slot = &queue->slots[pos & queue->mask];
+    unsigned seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+
+    if ((int)(seq - (pos + 1)) < 0) {
+        /* empty, or producer is still writing the slot */
+        return false;
+    }
+
+    *m = slot->msg;
+    queue->head = pos + 1;
+    /* hand the slot back to the producers for the next round */
+    atomic_store_explicit(&slot->seq, pos + queue->mask + 1,
+                          memory_order_release);
+
+    return true;
+}
@@ -33,6 +33,71 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/**
+ * @brief   Record @p thread as owner of the just obtained mutex
+ *
+ * @p thread is NULL when the mutex is locked before the scheduler started or
+ * from ISR context, then the mutex has no owner to boost
+ */
+static inline __attribute__((always_inline)) void _set_owner(mutex_t *mutex,
+                                                             thread_t *thread)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = (thread != NULL) ? thread->pid : KERNEL_PID_UNDEF;
+#else
+    (void)mutex;
+    (void)thread;
+#endif
+}
+
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+/**
+ * @brief   Lower the priority of @p owner to what the waiters on the mutexes
+ *          it holds require, in case it got boosted
+ * @pre     IRQs are disabled
+ */
+static void _update_priority(thread_t *owner)
+{
+    if ((owner == NULL) || (owner->priority == owner->base_priority)) {
+        return;
+    }
+
+    /* keep the boost by waiters on mutexes the owner still holds */
+    uint8_t priority = owner->base_priority;
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *waiter = thread_get(pid);
+
+        if ((waiter != NULL) && (waiter->status == STATUS_MUTEX_BLOCKED) &&
+            (((mutex_t *)waiter->mutex_waiting)->owner == owner->pid) &&
+            (waiter->priority < priority)) {
+            priority = waiter->priority;
+        }
+    }
+    DEBUG("PID[%" PRIkernel_pid "] mutex: restoring priority of %"
+          PRIkernel_pid " to %u\n", thread_getpid(), owner->pid,
+          (unsigned)priority);
+    sched_change_priority(owner, priority);
+}
+#endif
+
+/**
+ * @brief   Clear the owner of @p mutex and lower its priority to what the
+ *          mutexes it still holds require, in case it got boosted
+ * @pre     IRQs are disabled
+ */
+static inline __attribute__((always_inline)) void _restore_owner(mutex_t *mutex)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread_t *owner = thread_get(mutex->owner);
+
+    mutex->owner = KERNEL_PID_UNDEF;
+    _update_priority(owner);
+#else
+    (void)mutex;
+#endif
+}
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -55,6 +120,7 @@ static inline __attribute__((always_inline)) void _block(mutex_t *mutex,
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
+    sched_trace_callback(SCHED_TRACE_MUTEX_BLOCK, me->pid, (uintptr_t)mutex);
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = (list_node_t *)&me->rq_entry;
         mutex->queue.next->next = NULL;
@@ -63,6 +129,18 @@ static inline __attribute__((always_inline)) void _block(mutex_t *mutex,
         thread_add_to_list(&mutex->queue, me);
     }
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread_t *owner = thread_get(mutex->owner);
+
+    me->mutex_waiting = mutex;
+    if ((owner != NULL) && (owner->priority > me->priority)) {
+        DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): boosting priority of %"
+              PRIkernel_pid " to %u\n", thread_getpid(), owner->pid,
+              (unsigned)me->priority);
+        sched_change_priority(owner, me->priority);
+    }
+#endif
+
     irq_restore(irq_state);
     thread_yield_higher();
     /* We were woken up by scheduler. Waker removed us from queue. */
@@ -77,6 +155,7 @@ void mutex_lock(mutex_t *mutex)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _set_owner(mutex, irq_is_in() ? NULL : thread_get_active());
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -105,6 +184,7 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _set_owner(mutex, irq_is_in() ? NULL : thread_get_active());
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -133,6 +213,9 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
+    /* undo priority inheritance, if any */
+    _restore_owner(mutex);
+
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
@@ -144,9 +227,14 @@ void mutex_unlock(mutex_t *mutex)
 
     thread_t *process = container_of((clist_node_t *)next, thread_t, rq_entry);
 
+    /* the woken up thread now owns the mutex */
+    _set_owner(mutex, process);
+
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): waking up waiting thread %"
           PRIkernel_pid "\n", thread_getpid(),  process->pid);
     sched_set_status(process, STATUS_PENDING);
+    sched_trace_callback(SCHED_TRACE_MUTEX_UNBLOCK, process->pid,
+                         (uintptr_t)mutex);
 
     if (!mutex->queue.next) {
         mutex->queue.next = MUTEX_LOCKED;
@@ -165,6 +253,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
+        _restore_owner(mutex);
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
         }
@@ -172,9 +261,12 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             list_node_t *next = list_remove_head(&mutex->queue);
             thread_t *process = container_of((clist_node_t *)next, thread_t,
                                              rq_entry);
+            _set_owner(mutex, process);
             DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): waking up "
                   "waiter.\n", process->pid);
             sched_set_status(process, STATUS_PENDING);
+            sched_trace_callback(SCHED_TRACE_MUTEX_UNBLOCK, process->pid,
+                                 (uintptr_t)mutex);
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
@@ -212,6 +304,10 @@ void mutex_cancel(mutex_cancel_t *mc)
             mutex->queue.next = MUTEX_LOCKED;
         }
         sched_set_status(thread, STATUS_PENDING);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        /* drop the boost the owner got from the cancelled thread */
+        _update_priority(thread_get(mutex->owner));
+#endif
         irq_restore(irq_state);
         sched_switch(thread->priority);
         return;
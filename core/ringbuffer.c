@@ -16,10 +16,11 @@
  * @}
  */
 
-#include "ringbuffer.h"
-
+#include <assert.h>
 #include <string.h>
 
+#include "ringbuffer.h"
+
 /**
  * @brief           Add an element to the end of the ringbuffer.
  * @details         This helper function does not check the pre-requirements for adding,
@@ -56,15 +57,28 @@ static char get_head(ringbuffer_t *restrict rb)
 
 unsigned ringbuffer_add(ringbuffer_t *restrict rb, const char *buf, unsigned n)
 {
-    unsigned i;
+    unsigned free = rb->size - rb->avail;
 
-    for (i = 0; i < n; i++) {
-        if (ringbuffer_full(rb)) {
-            break;
+    if (n > free) {
+        n = free;
+    }
+    if (n > 0) {
+        unsigned pos = rb->start + rb->avail;
+        if (pos >= rb->size) {
+            pos -= rb->size;
         }
-        add_tail(rb, buf[i]);
+        /* copy in at most two segments, the second one wraps around */
+        unsigned bytes_till_end = rb->size - pos;
+        if (bytes_till_end >= n) {
+            memcpy(rb->buf + pos, buf, n);
+        }
+        else {
+            memcpy(rb->buf + pos, buf, bytes_till_end);
+            memcpy(rb->buf, buf + bytes_till_end, n - bytes_till_end);
+        }
+        rb->avail += n;
     }
-    return i;
+    return n;
 }
 
 int ringbuffer_add_one(ringbuffer_t *restrict rb, char c)
@@ -147,3 +161,32 @@ unsigned ringbuffer_peek(const ringbuffer_t *restrict rb_, char *buf,
 
     return ringbuffer_get(&rb, buf, n);
 }
+
+unsigned ringbuffer_get_write_span(ringbuffer_t *restrict rb, char **buf)
+{
+    unsigned pos = rb->start + rb->avail;
+
+    if (pos >= rb->size) {
+        /* free space is between the wrapped around end and start */
+        pos -= rb->size;
+        *buf = rb->buf + pos;
+        return rb->start - pos;
+    }
+    *buf = rb->buf + pos;
+    return rb->size - pos;
+}
+
+void ringbuffer_commit(ringbuffer_t *restrict rb, unsigned n)
+{
+    assert(n <= rb->size - rb->avail);
+    rb->avail += n;
+}
+
+unsigned ringbuffer_peek_read_span(const ringbuffer_t *restrict rb,
+                                   const char **buf)
+{
+    unsigned bytes_till_end = rb->size - rb->start;
+
+    *buf = rb->buf + rb->start;
+    return (rb->avail < bytes_till_end) ? rb->avail : bytes_till_end;
+}
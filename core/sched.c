@@ -19,6 +19,8 @@
  * @}
  */
 
+#include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <inttypes.h>
 
@@ -113,6 +115,57 @@ static inline unsigned _get_prio_queue_from_runqueue(void)
 #endif
 }
 
+#ifdef MODULE_SCHED_EDF
+/* true if @p a has to be scheduled before @p b of the same priority */
+static inline bool _edf_before(const thread_t *a, const thread_t *b)
+{
+    if (!a->has_deadline) {
+        return false;
+    }
+    if (!b->has_deadline) {
+        return true;
+    }
+    return (int32_t)(a->deadline - b->deadline) < 0;
+}
+
+/* inserts @p process into @p rq, keeping threads with a deadline sorted at
+ * the head of the runqueue. A thread whose deadline got cleared keeps its
+ * position, so threads with a deadline may be queued behind it: those with an
+ * earlier deadline than @p process stay in front of it. */
+static void _runqueue_insert(clist_node_t *rq, thread_t *process)
+{
+    clist_node_t *last = rq->next;
+
+    if (process->has_deadline && last) {
+        clist_node_t *prev = last;
+        clist_node_t *pos = NULL;
+
+        do {
+            clist_node_t *node = prev->next;
+            thread_t *thread = container_of(node, thread_t, rq_entry);
+
+            if (_edf_before(process, thread)) {
+                if (pos == NULL) {
+                    pos = prev;
+                }
+            }
+            else if (thread->has_deadline) {
+                pos = NULL;
+            }
+            prev = node;
+        } while (prev != last);
+
+        if (pos != NULL) {
+            process->rq_entry.next = pos->next;
+            pos->next = &process->rq_entry;
+            return;
+        }
+    }
+
+    clist_rpush(rq, &process->rq_entry);
+}
+#endif /* MODULE_SCHED_EDF */
+
 static void _unschedule(thread_t *active_thread)
 {
     if (active_thread->status == STATUS_RUNNING) {
@@ -142,6 +195,8 @@ thread_t *__attribute__((used)) sched_run(void)
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) && !runqueue_bitcache) {
         if (active_thread) {
             _unschedule(active_thread);
+            sched_trace_callback(SCHED_TRACE_SWITCH, KERNEL_PID_UNDEF,
+                                 (uint16_t)active_thread->pid);
             active_thread = NULL;
         }
 
@@ -177,6 +232,10 @@ thread_t *__attribute__((used)) sched_run(void)
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
         }
 #endif
+        if (!active_thread) {
+            sched_trace_callback(SCHED_TRACE_SWITCH, next_thread->pid,
+                                 (uint16_t)KERNEL_PID_UNDEF);
+        }
         DEBUG("sched_run: done, sched_active_thread was not changed.\n");
     }
     else {
@@ -187,6 +246,15 @@ thread_t *__attribute__((used)) sched_run(void)
         sched_active_pid = next_thread->pid;
         sched_active_thread = next_thread;
 
+        sched_trace_callback(SCHED_TRACE_SWITCH, next_thread->pid,
+                             (uint16_t)((active_thread == NULL)
+                                        ? KERNEL_PID_UNDEF
+                                        : active_thread->pid));
+
+#ifdef MODULE_SCHED_ROUND_ROBIN
+        sched_runq_callback(next_thread->priority);
+#endif
+
 #ifdef MODULE_SCHED_CB
         if (sched_cb) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
@@ -210,6 +278,19 @@ thread_t *__attribute__((used)) sched_run(void)
     return next_thread;
 }
 
+static void _runqueue_push(thread_t *process)
+{
+#ifdef MODULE_SCHED_EDF
+    _runqueue_insert(&sched_runqueues[process->priority], process);
+#else
+    clist_rpush(&sched_runqueues[process->priority], &(process->rq_entry));
+#endif
+    _set_runqueue_bit(process);
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    sched_runq_callback(process->priority);
+#endif
+}
+
 void sched_set_status(thread_t *process, thread_status_t status)
 {
     if (status >= STATUS_ON_RUNQUEUE) {
@@ -217,9 +298,7 @@ void sched_set_status(thread_t *process, thread_status_t status)
             DEBUG(
                 "sched_set_status: adding thread %" PRIkernel_pid " to runqueue %" PRIu8 ".\n",
                 process->pid, process->priority);
-            clist_rpush(&sched_runqueues[process->priority],
-                        &(process->rq_entry));
-            _set_runqueue_bit(process);
+            _runqueue_push(process);
         }
     }
     else {
@@ -227,11 +306,22 @@ void sched_set_status(thread_t *process, thread_status_t status)
             DEBUG(
                 "sched_set_status: removing thread %" PRIkernel_pid " from runqueue %" PRIu8 ".\n",
                 process->pid, process->priority);
+#ifdef MODULE_SCHED_EDF
+            /* the thread is not necessarily at the head of the runqueue, as
+             * threads with an earlier deadline may have been inserted before
+             * it */
+            clist_remove(&sched_runqueues[process->priority],
+                         &(process->rq_entry));
+#else
             clist_lpop(&sched_runqueues[process->priority]);
+#endif
 
             if (!sched_runqueues[process->priority].next) {
                 _clear_runqueue_bit(process);
             }
+#ifdef MODULE_SCHED_ROUND_ROBIN
+            sched_runq_callback(process->priority);
+#endif
         }
     }
 
@@ -249,6 +339,15 @@ void sched_switch(uint16_t other_prio)
           active_thread->pid, current_prio, on_runqueue,
           other_prio);
 
+#ifdef MODULE_SCHED_EDF
+    /* a thread of the same priority with an earlier deadline got inserted at
+     * the head of the runqueue */
+    if (on_runqueue && (current_prio == other_prio)
+        && (sched_runqueues[current_prio].next->next != &active_thread->rq_entry)) {
+        current_prio++;
+    }
+#endif
+
     if (!on_runqueue || (current_prio > other_prio)) {
         if (irq_is_in()) {
             DEBUG("sched_switch: setting sched_context_switch_request.\n");
@@ -264,12 +363,57 @@ void sched_switch(uint16_t other_prio)
     }
 }
 
+void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+    assert(thread && (priority < SCHED_PRIO_LEVELS));
+
+    unsigned irq_state = irq_disable();
+    uint8_t old_priority = thread->priority;
+
+    if (old_priority == priority) {
+        irq_restore(irq_state);
+        return;
+    }
+
+    if (thread->status >= STATUS_ON_RUNQUEUE) {
+        clist_remove(&sched_runqueues[old_priority], &thread->rq_entry);
+        if (!sched_runqueues[old_priority].next) {
+            _clear_runqueue_bit(thread);
+        }
+#ifdef MODULE_SCHED_ROUND_ROBIN
+        sched_runq_callback(old_priority);
+#endif
+
+        thread->priority = priority;
+        if (thread == thread_get_active()) {
+            /* the running thread stays at the head of its runqueue, as
+             * sched_set_status() expects it there */
+            clist_lpush(&sched_runqueues[priority], &thread->rq_entry);
+            _set_runqueue_bit(thread);
+#ifdef MODULE_SCHED_ROUND_ROBIN
+            sched_runq_callback(priority);
+#endif
+        }
+        else {
+            _runqueue_push(thread);
+        }
+    }
+    else {
+        thread->priority = priority;
+    }
+
+    irq_restore(irq_state);
+}
+
 NORETURN void sched_task_exit(void)
 {
     DEBUG("sched_task_exit: ending thread %" PRIkernel_pid "...\n",
           thread_getpid());
 
     (void)irq_disable();
+#ifdef MODULE_SCHED_EDF
+    sched_exit_callback(thread_getpid());
+#endif
     sched_threads[thread_getpid()] = NULL;
     sched_num_threads--;
 
@@ -279,6 +423,38 @@ NORETURN void sched_task_exit(void)
     cpu_switch_context_exit();
 }
 
+#ifdef MODULE_SCHED_EDF
+void sched_set_deadline(thread_t *thread, uint32_t deadline)
+{
+    unsigned state = irq_disable();
+    int on_runqueue = (thread->status >= STATUS_ON_RUNQUEUE);
+    clist_node_t *rq = &sched_runqueues[thread->priority];
+
+    if (on_runqueue) {
+        clist_remove(rq, &thread->rq_entry);
+    }
+    thread->deadline = deadline;
+    thread->has_deadline = 1;
+    if (on_runqueue) {
+        _runqueue_insert(rq, thread);
+    }
+
+    irq_restore(state);
+
+    if (on_runqueue && (thread_get_active() != NULL)) {
+        sched_switch(thread->priority);
+    }
+}
+
+void sched_clear_deadline(thread_t *thread)
+{
+    /* the thread keeps its position in the runqueue: moving it behind the
+     * threads of its priority would let a busy thread without a deadline
+     * starve it */
+    thread->has_deadline = 0;
+}
+#endif /* MODULE_SCHED_EDF */
+
 #ifdef MODULE_SCHED_CB
 void sched_register_cb(void (*callback)(kernel_pid_t, kernel_pid_t))
 {
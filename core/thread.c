@@ -291,12 +291,24 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 
     thread->rq_entry.next = NULL;
 
+#ifdef MODULE_SCHED_EDF
+    thread->has_deadline = 0;
+#endif
+
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->base_priority = priority;
+    thread->mutex_waiting = NULL;
+#endif
+
 #ifdef MODULE_CORE_MSG
     thread->wait_data = NULL;
     thread->msg_waiters.next = NULL;
     cib_init(&(thread->msg_queue), 0);
     thread->msg_array = NULL;
 #endif
+#ifdef MODULE_CORE_MSG_MPSC
+    thread->msg_mpsc = NULL;
+#endif
 
     sched_num_threads++;
 
@@ -78,6 +78,7 @@ static void _thread_flags_wait(thread_flags_t mask, thread_t *thread,
 
     thread->wait_data = (void *)(unsigned)mask;
     sched_set_status(thread, threadstate);
+    sched_trace_callback(SCHED_TRACE_THREAD_FLAGS_WAIT, thread->pid, mask);
     irq_restore(irqstate);
     thread_yield_higher();
 }
@@ -148,6 +149,7 @@ void thread_flags_set(thread_t *thread, thread_flags_t mask)
           mask, thread->pid);
     unsigned state = irq_disable();
 
+    sched_trace_callback(SCHED_TRACE_THREAD_FLAGS_SET, thread->pid, mask);
     thread->flags |= mask;
     if (_thread_flags_wake(thread)) {
         irq_restore(state);
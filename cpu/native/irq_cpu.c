@@ -37,6 +37,7 @@
 #include "irq.h"
 #include "cpu.h"
 #include "periph/pm.h"
+#include "trace_event.h"
 
 #include "native_internal.h"
 
@@ -260,7 +261,9 @@ void native_irq_handler(void)
 
         if (native_irq_handlers[sig] != NULL) {
             DEBUG("native_irq_handler: calling interrupt handler for %i\n", sig);
+            trace_event_isr_enter(sig);
             native_irq_handlers[sig]();
+            trace_event_isr_exit(sig);
         }
         else if (sig == SIGUSR1) {
             warnx("native_irq_handler: ignoring SIGUSR1");
@@ -300,6 +300,14 @@ static int stm32_eth_get(netdev_t *dev, netopt_t opt,
         }
         res = sizeof(netopt_enable_t);
         break;
+    case NETOPT_TX_CSUM_OFFLOAD:
+    case NETOPT_RX_CSUM_VALID:
+        /* see TX_DESC_STAT_CIC in stm32_eth_send() and ETH_MACCR_IPCO in
+         * stm32_eth_init() */
+        assert(max_len == sizeof(netopt_enable_t));
+        *((netopt_enable_t *)value) = NETOPT_ENABLE;
+        res = sizeof(netopt_enable_t);
+        break;
     default:
         res = netdev_eth_get(dev, opt, value, max_len);
         break;
@@ -425,7 +433,8 @@ static int stm32_eth_init(netdev_t *netdev)
     ETH->MACMIIAR = CLOCK_RANGE;
 
     /* ROD  = Don't receive own frames in half-duplex mode
-     * IPCO = Drop IPv4 packets carrying TCP/UDP/ICMP when checksum is invalid
+     * IPCO = Drop IPv4 and IPv6 packets carrying TCP/UDP/ICMP(v6) when the
+     *        checksum of the upper-layer header is invalid
      * APCS = Do not pass padding and CRC fields to application (CRC is checked
      *        by hardware already) */
     ETH->MACCR |= ETH_MACCR_ROD | ETH_MACCR_IPCO | ETH_MACCR_APCS;
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT Developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Convert the output of `trace_event_dump()` (module `trace_event`) to the
+Chrome trace event JSON format, as understood by Perfetto and chrome://tracing.
+
+Lines not starting with `trace_event:` are ignored, so the terminal output of
+a whole session can be used as input. If it contains several dumps, only the
+last one is converted.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+SCHED_SWITCH = 1
+MSG_SEND = 2
+MSG_RECV = 3
+MUTEX_BLOCK = 4
+MUTEX_UNBLOCK = 5
+THREAD_FLAGS_SET = 6
+THREAD_FLAGS_WAIT = 7
+ISR_ENTER = 8
+ISR_EXIT = 9
+USER = 10
+
+FLAG_ISR = 0x01
+
+KERNEL_PID_UNDEF = 0
+
+# events that make a thread runnable, used to compute the scheduling latency
+WAKEUPS = (MSG_SEND, MUTEX_UNBLOCK, THREAD_FLAGS_SET)
+
+NAMES = {
+    MSG_SEND: "msg_send",
+    MSG_RECV: "msg_receive",
+    MUTEX_BLOCK: "mutex_block",
+    MUTEX_UNBLOCK: "mutex_unblock",
+    THREAD_FLAGS_SET: "thread_flags_set",
+    THREAD_FLAGS_WAIT: "thread_flags_wait",
+    USER: "user",
+}
+
+# tid used for the interrupt track, real threads use their pid
+ISR_TID = 0
+PROCESS_ID = 1
+
+HEADER = re.compile(r"trace_event: version=(\d+) events=(\d+) lost=(\d+) "
+                    r"isr_pid=(\d+) freq=(\d+) width=(\d+)")
+THREAD = re.compile(r"trace_event: thread (\d+) (\S+)")
+EVENT = re.compile(r"trace_event: ([0-9a-f]{8}) ([0-9a-f]{2}) ([0-9a-f]{2}) "
+                   r"([0-9a-f]{4}) ([0-9a-f]{8})")
+
+
+def parse(lines):
+    """Return (threads, events, lost, freq, width) of the last dump found in
+    lines"""
+    dump = None
+    for line in lines:
+        idx = line.find("trace_event: ")
+        if idx < 0:
+            continue
+        line = line[idx:].strip()
+        match = HEADER.match(line)
+        if match:
+            if int(match.group(1)) != 2:
+                sys.exit("unsupported dump version {}".format(match.group(1)))
+            dump = ({int(match.group(4)): "isr"}, [], int(match.group(3)),
+                    int(match.group(5)), int(match.group(6)))
+            continue
+        if dump is None:
+            continue
+        match = THREAD.match(line)
+        if match:
+            dump[0][int(match.group(1))] = match.group(2)
+            continue
+        match = EVENT.match(line)
+        if match:
+            time, etype, flags, pid, arg = (int(g, 16) for g in match.groups())
+            if pid & 0x8000:
+                pid -= 0x10000
+            dump[1].append((time, etype, flags, pid, arg))
+    if dump is None:
+        sys.exit("no trace_event dump found")
+    return dump
+
+
+def unwrap(events, freq, width):
+    """Turn the timer ticks of the given width into monotonic microseconds"""
+    offset = 0
+    last = None
+    for time, etype, flags, pid, arg in events:
+        if last is not None and time < last:
+            offset += 1 << width
+        last = time
+        yield ((time + offset) * 1000000 / freq, etype, flags, pid, arg)
+
+
+def pid_name(threads, pid):
+    if pid == KERNEL_PID_UNDEF:
+        return "none"
+    return threads.get(pid, str(pid))
+
+
+def convert(threads, events, freq, width):
+    """Return the list of Chrome trace events and per thread latencies"""
+    out = []
+    latencies = {}
+    running = None
+    running_since = None
+    woken = {}
+    t_first = None
+
+    def meta(tid, name):
+        out.append({"name": "thread_name", "ph": "M", "pid": PROCESS_ID,
+                    "tid": tid, "args": {"name": name}})
+
+    meta(ISR_TID, "ISR")
+    for pid, name in sorted(threads.items()):
+        if name != "isr":
+            meta(pid, "{} ({})".format(name, pid))
+
+    for time, etype, flags, pid, arg in unwrap(events, freq, width):
+        if t_first is None:
+            t_first = time
+        ts = time - t_first
+        in_isr = bool(flags & FLAG_ISR)
+
+        if etype == SCHED_SWITCH:
+            if running not in (None, KERNEL_PID_UNDEF):
+                out.append({"name": "running", "ph": "X", "pid": PROCESS_ID,
+                            "tid": running, "ts": running_since,
+                            "dur": ts - running_since})
+            running = pid
+            running_since = ts
+            if pid in woken:
+                latency = ts - woken.pop(pid)
+                latencies.setdefault(pid, []).append(latency)
+                out.append({"name": "scheduled", "ph": "i", "s": "t",
+                            "pid": PROCESS_ID, "tid": pid, "ts": ts,
+                            "args": {"latency_us": latency}})
+        elif etype in (ISR_ENTER, ISR_EXIT):
+            out.append({"name": "irq {}".format(arg),
+                        "ph": "B" if etype == ISR_ENTER else "E",
+                        "pid": PROCESS_ID, "tid": ISR_TID, "ts": ts})
+        else:
+            if etype in WAKEUPS and pid not in woken and pid != running:
+                woken[pid] = ts
+            if etype in (MUTEX_BLOCK, MUTEX_UNBLOCK):
+                args = {"thread": pid_name(threads, pid),
+                        "mutex": "0x{:08x}".format(arg)}
+            elif etype in (THREAD_FLAGS_SET, THREAD_FLAGS_WAIT):
+                args = {"thread": pid_name(threads, pid),
+                        "flags": "0x{:04x}".format(arg)}
+            elif etype in (MSG_SEND, MSG_RECV):
+                args = {"target" if etype == MSG_SEND else "sender":
+                        pid_name(threads, pid),
+                        "type": "0x{:04x}".format(arg)}
+            else:
+                args = {"value": "0x{:08x}".format(arg)}
+            tid = ISR_TID if in_isr or running is None else running
+            out.append({"name": NAMES.get(etype, "event {}".format(etype)),
+                        "ph": "i", "s": "t", "pid": PROCESS_ID, "tid": tid,
+                        "ts": ts, "args": args})
+
+    return out, latencies
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("dump", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="terminal output containing the dump "
+                        "(default: stdin)")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout,
+                        help="JSON file to write (default: stdout)")
+    args = parser.parse_args()
+
+    threads, events, lost, freq, width = parse(args.dump)
+    out, latencies = convert(threads, events, freq, width)
+    json.dump({"traceEvents": out}, args.output)
+
+    if lost:
+        print("{} events were overwritten before the dump".format(lost),
+              file=sys.stderr)
+    for pid, values in sorted(latencies.items()):
+        print("{:>16}: {} wakeups, scheduling latency avg {:.1f} us, "
+              "max {:.1f} us".format(pid_name(threads, pid), len(values),
+                                 sum(values) / len(values), max(values)),
+              file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
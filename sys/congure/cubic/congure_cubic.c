@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <stddef.h>
+
+#include "timex.h"
+
+#include "congure/cubic.h"
+
+/* C = 0.4 */
+#define CUBIC_C_NUM             (4U)
+#define CUBIC_C_DEN             (10U)
+/* beta_cubic = 0.7 */
+#define CUBIC_BETA_NUM          (7U)
+#define CUBIC_BETA_DEN          (10U)
+/* alpha of the TCP-friendly region, 3 * (1 - beta) / (1 + beta) = 9 / 17 */
+#define CUBIC_ALPHA_NUM         (9U)
+#define CUBIC_ALPHA_DEN         (17U)
+/* bound for |t - K| in the growth function, so its cube does not overflow */
+#define CUBIC_MAX_OFFSET_MS     (100U * MS_PER_SEC)
+
+static void _snd_init(congure_snd_t *cong, void *ctx);
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs);
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs);
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack);
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time);
+
+static const congure_snd_driver_t _driver = {
+    .init = _snd_init,
+    .inter_msg_interval = _snd_inter_msg_interval,
+    .report_msg_sent = _snd_report_msg_sent,
+    .report_msg_discarded = _snd_report_msg_discarded,
+    .report_msgs_timeout = _snd_report_msgs_timeout,
+    .report_msgs_lost = _snd_report_msgs_lost,
+    .report_msg_acked = _snd_report_msg_acked,
+    .report_ecn_ce = _snd_report_ecn_ce,
+};
+
+static congure_wnd_size_t _bound(uint64_t wnd)
+{
+    return (wnd < CONGURE_WND_SIZE_MAX) ? wnd : CONGURE_WND_SIZE_MAX;
+}
+
+/* bitwise integer cube root, see Hacker's Delight, section 11-2 */
+static uint32_t _cbrt(uint64_t x)
+{
+    uint64_t y = 0;
+
+    for (int s = 63; s >= 0; s -= 3) {
+        uint64_t b;
+
+        y <<= 1;
+        b = 3 * y * (y + 1) + 1;
+        if ((x >> s) >= b) {
+            x -= b << s;
+            y++;
+        }
+    }
+    return y;
+}
+
+/* RFC 8312, equation (1) with t in milliseconds */
+static congure_wnd_size_t _w_cubic(congure_cubic_snd_t *c, uint32_t t)
+{
+    int64_t offset = (int64_t)t - c->k;
+    int64_t w;
+
+    if (offset > (int64_t)CUBIC_MAX_OFFSET_MS) {
+        offset = CUBIC_MAX_OFFSET_MS;
+    }
+    else if (offset < -(int64_t)CUBIC_MAX_OFFSET_MS) {
+        offset = -(int64_t)CUBIC_MAX_OFFSET_MS;
+    }
+    /* C * mss * (offset / 1000)^3, ordered to neither overflow nor lose
+     * precision */
+    w = ((offset * offset * offset) / 1000) * (int64_t)(CUBIC_C_NUM * c->super.mss);
+    w = c->w_max + (w / (int64_t)(CUBIC_C_DEN * US_PER_SEC));
+    return (w > 0) ? _bound(w) : 0;
+}
+
+static void _start_epoch(congure_cubic_snd_t *c, ztimer_now_t now)
+{
+    congure_wnd_size_t cwnd = c->super.super.cwnd;
+
+    /* 0 marks an unset epoch */
+    c->epoch_start = (now != 0) ? now : 1;
+    if (cwnd < c->w_max) {
+        /* RFC 8312, equation (2) */
+        uint64_t diff = ((uint64_t)(c->w_max - cwnd) * CUBIC_C_DEN *
+                         US_PER_SEC * MS_PER_SEC) /
+                        (CUBIC_C_NUM * c->super.mss);
+
+        c->k = _cbrt(diff);
+    }
+    else {
+        c->k = 0;
+        c->w_max = cwnd;
+    }
+    c->w_est = cwnd;
+}
+
+static void _reduce(congure_cubic_snd_t *c)
+{
+    congure_wnd_size_t cwnd = c->super.super.cwnd;
+    uint32_t ssthresh = ((uint32_t)cwnd * CUBIC_BETA_NUM) / CUBIC_BETA_DEN;
+
+    c->epoch_start = 0;
+    /* fast convergence, see RFC 8312, section 4.6 */
+    if (cwnd < c->w_last_max) {
+        c->w_last_max = cwnd;
+        c->w_max = ((uint32_t)cwnd * (CUBIC_BETA_DEN + CUBIC_BETA_NUM)) /
+                   (2 * CUBIC_BETA_DEN);
+    }
+    else {
+        c->w_last_max = cwnd;
+        c->w_max = cwnd;
+    }
+    if (ssthresh < (2U * c->super.mss)) {
+        ssthresh = 2U * c->super.mss;
+    }
+    c->super.ssthresh = _bound(ssthresh);
+}
+
+void congure_cubic_snd_setup(congure_cubic_snd_t *c, unsigned mss)
+{
+    assert(mss > 0);
+    c->super.super.driver = &_driver;
+    c->super.mss = _bound(mss);
+}
+
+static void _snd_init(congure_snd_t *cong, void *ctx)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    c->super.super.ctx = ctx;
+    c->super.super.cwnd = congure_reno_snd_init_wnd(c->super.mss);
+    c->super.ssthresh = CONGURE_WND_SIZE_MAX;
+    c->super.in_flight_size = 0;
+    c->w_max = 0;
+    c->w_last_max = 0;
+    c->w_est = 0;
+    c->k = 0;
+    c->epoch_start = 0;
+    c->rtt_min = 0;
+}
+
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size)
+{
+    (void)cong;
+    (void)msg_size;
+    return -1;
+}
+
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    c->super.in_flight_size = _bound((uint32_t)c->super.in_flight_size +
+                                     msg_size);
+}
+
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    c->super.in_flight_size = (msg_size < c->super.in_flight_size)
+                            ? c->super.in_flight_size - msg_size : 0;
+}
+
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    (void)msgs;
+    _reduce(c);
+    c->super.super.cwnd = c->super.ssthresh;
+}
+
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    (void)msgs;
+    _reduce(c);
+    /* restart with the loss window of one message */
+    c->super.super.cwnd = c->super.mss;
+}
+
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+    congure_wnd_size_t cwnd = c->super.super.cwnd;
+    int32_t rtt = ack->recv_time - msg->send_time;
+
+    _snd_report_msg_discarded(cong, msg->size);
+    /* Karn's algorithm: the ACK of a resent message is ambiguous */
+    if ((msg->resends == 0) && (rtt > 0) &&
+        ((c->rtt_min == 0) || ((uint32_t)rtt < c->rtt_min))) {
+        c->rtt_min = rtt;
+    }
+    if (cwnd < c->super.ssthresh) {
+        /* slow start */
+        c->super.super.cwnd = _bound((uint32_t)cwnd +
+                                     ((msg->size < c->super.mss)
+                                      ? msg->size : c->super.mss));
+        return;
+    }
+    if (c->epoch_start == 0) {
+        _start_epoch(c, ack->recv_time);
+    }
+
+    uint32_t t = ack->recv_time - c->epoch_start;
+    /* window one round-trip time ahead, see RFC 8312, section 4.1 */
+    uint32_t target = _w_cubic(c, t + c->rtt_min);
+
+    /* RFC 8312, equation (4), applied per ACK */
+    c->w_est = _bound(c->w_est + ((uint64_t)CUBIC_ALPHA_NUM * msg->size *
+                                  c->super.mss) /
+                                 ((uint64_t)CUBIC_ALPHA_DEN * cwnd));
+    if (_w_cubic(c, t) < c->w_est) {
+        /* TCP-friendly region */
+        if (c->w_est > cwnd) {
+            c->super.super.cwnd = c->w_est;
+        }
+    }
+    else if (target > cwnd) {
+        /* concave and convex region, at most 1.5 * cwnd per round-trip */
+        if (target > (cwnd + (cwnd / 2U))) {
+            target = cwnd + (cwnd / 2U);
+        }
+        c->super.super.cwnd = _bound(cwnd + (((uint64_t)(target - cwnd) *
+                                              msg->size) / cwnd));
+    }
+}
+
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time)
+{
+    (void)time;
+    /* react as for a lost message, see RFC 8312, section 4.5 */
+    _snd_report_msgs_lost(cong, NULL);
+}
+
+/** @} */
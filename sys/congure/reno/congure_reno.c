@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <stddef.h>
+
+#include "congure/reno.h"
+
+static void _snd_init(congure_snd_t *cong, void *ctx);
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs);
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs);
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack);
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time);
+
+static const congure_snd_driver_t _driver = {
+    .init = _snd_init,
+    .inter_msg_interval = _snd_inter_msg_interval,
+    .report_msg_sent = _snd_report_msg_sent,
+    .report_msg_discarded = _snd_report_msg_discarded,
+    .report_msgs_timeout = _snd_report_msgs_timeout,
+    .report_msgs_lost = _snd_report_msgs_lost,
+    .report_msg_acked = _snd_report_msg_acked,
+    .report_ecn_ce = _snd_report_ecn_ce,
+};
+
+static congure_wnd_size_t _add(congure_wnd_size_t a, unsigned b)
+{
+    return (b < (unsigned)(CONGURE_WND_SIZE_MAX - a)) ? a + b
+                                                      : CONGURE_WND_SIZE_MAX;
+}
+
+static congure_wnd_size_t _sub(congure_wnd_size_t a, unsigned b)
+{
+    return (b < a) ? a - b : 0;
+}
+
+void congure_reno_snd_setup(congure_reno_snd_t *c, unsigned mss)
+{
+    assert(mss > 0);
+    c->super.driver = &_driver;
+    c->mss = (mss < CONGURE_WND_SIZE_MAX) ? mss : CONGURE_WND_SIZE_MAX;
+}
+
+congure_wnd_size_t congure_reno_snd_init_wnd(unsigned mss)
+{
+    unsigned segs = (mss > 2190) ? 2 : ((mss > 1095) ? 3 : 4);
+
+    return _add(0, segs * mss);
+}
+
+/* RFC 5681, equation (4) */
+static void _reduce_ssthresh(congure_reno_snd_t *c)
+{
+    unsigned min = 2 * c->mss;
+    unsigned half = c->in_flight_size / 2;
+
+    c->ssthresh = _add(0, (half > min) ? half : min);
+}
+
+static void _snd_init(congure_snd_t *cong, void *ctx)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    c->super.ctx = ctx;
+    c->super.cwnd = congure_reno_snd_init_wnd(c->mss);
+    c->ssthresh = CONGURE_WND_SIZE_MAX;
+    c->in_flight_size = 0;
+}
+
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size)
+{
+    (void)cong;
+    (void)msg_size;
+    return -1;
+}
+
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    c->in_flight_size = _add(c->in_flight_size, msg_size);
+}
+
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    c->in_flight_size = _sub(c->in_flight_size, msg_size);
+}
+
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    (void)msgs;
+    _reduce_ssthresh(c);
+    c->super.cwnd = c->ssthresh;
+}
+
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    (void)msgs;
+    _reduce_ssthresh(c);
+    /* restart with the loss window of one message */
+    c->super.cwnd = c->mss;
+}
+
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    (void)ack;
+    c->in_flight_size = _sub(c->in_flight_size, msg->size);
+    if (c->super.cwnd < c->ssthresh) {
+        /* slow start: RFC 5681, equation (2) */
+        c->super.cwnd = _add(c->super.cwnd,
+                             (msg->size < c->mss) ? msg->size : c->mss);
+    }
+    else {
+        /* congestion avoidance: RFC 5681, equation (3) */
+        unsigned inc = ((uint32_t)c->mss * c->mss) / c->super.cwnd;
+
+        c->super.cwnd = _add(c->super.cwnd, (inc > 0) ? inc : 1);
+    }
+}
+
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time)
+{
+    (void)time;
+    /* react as for a lost message, see RFC 3168, section 6.1.2 */
+    _snd_report_msgs_lost(cong, NULL);
+}
+
+/** @} */
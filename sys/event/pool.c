@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Event Pool implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "event/pool.h"
+
+/* take the oldest event of the first worker with a non-empty queue, starting
+ * with @p me */
+static event_t *_get(event_pool_t *pool, event_pool_worker_t *me)
+{
+    unsigned start = me - pool->workers;
+
+    for (unsigned i = 0; i < pool->numof; i++) {
+        event_pool_worker_t *worker = &pool->workers[(start + i) % pool->numof];
+        event_t *event = event_get(&worker->queue);
+        if (event) {
+            return event;
+        }
+    }
+
+    return NULL;
+}
+
+static void *_worker_thread(void *arg)
+{
+    event_pool_worker_t *me = arg;
+    event_pool_t *pool = me->pool;
+
+    event_queue_claim(&me->queue);
+
+    while (1) {
+        event_t *event = _get(pool, me);
+        while (!event) {
+            /* Advertise being idle before checking again, so that an event
+             * posted in between either gets found or posted to this worker.
+             * Needs to be repeated after waking up, as another worker might
+             * have taken the event posted to this one. */
+            me->idle = true;
+            event = _get(pool, me);
+            if (!event) {
+                thread_flags_wait_any(THREAD_FLAG_EVENT);
+                event = _get(pool, me);
+            }
+        }
+        me->idle = false;
+        event->handler(event);
+    }
+
+    /* should be never reached */
+    return NULL;
+}
+
+void event_pool_init(event_pool_t *pool, event_pool_worker_t *workers,
+                     unsigned numof, char *stacks, size_t stack_size,
+                     uint8_t priority)
+{
+    assert(pool && workers && numof);
+
+    pool->workers = workers;
+    pool->numof = numof;
+    pool->next = 0;
+
+    /* events may be posted before the workers got to claim their queues */
+    for (unsigned i = 0; i < numof; i++) {
+        event_queue_init_detached(&workers[i].queue);
+        workers[i].pool = pool;
+        workers[i].idle = false;
+    }
+
+    for (unsigned i = 0; i < numof; i++) {
+        thread_create(stacks + i * stack_size, stack_size, priority, 0,
+                      _worker_thread, &workers[i], "event_pool");
+    }
+}
+
+void event_pool_post(event_pool_t *pool, event_t *event)
+{
+    event_pool_worker_t *target = NULL;
+
+    unsigned state = irq_disable();
+    for (unsigned i = 0; i < pool->numof; i++) {
+        if (pool->workers[i].idle) {
+            target = &pool->workers[i];
+            /* claim it, so that the next event goes to another worker */
+            target->idle = false;
+            break;
+        }
+    }
+    if (!target) {
+        target = &pool->workers[pool->next];
+        pool->next = (pool->next + 1) % pool->numof;
+    }
+    irq_restore(state);
+
+    event_post(&target->queue, event);
+}
+
+void event_pool_cancel(event_pool_t *pool, event_t *event)
+{
+    for (unsigned i = 0; i < pool->numof; i++) {
+        event_cancel(&pool->workers[i].queue, event);
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_congure_cubic   CongURE implementation of CUBIC
+ * @ingroup     sys_congure
+ * @brief       Implementation of the CUBIC congestion control mechanism
+ *              for @ref sys_congure
+ *
+ * Implements the window growth function, the TCP-friendly region and fast
+ * convergence as specified in [RFC 8312](https://tools.ietf.org/html/rfc8312)
+ * with C = 0.4 and beta_cubic = 0.7. Slow start and the initial window are
+ * the same as with @ref sys_congure_reno.
+ *
+ * The time since the last window reduction is taken from
+ * congure_snd_ack_t::recv_time and the round-trip time from the difference to
+ * congure_snd_msg_t::send_time of messages that were not resent, so both
+ * need to be provided by the caller in milliseconds.
+ * @{
+ *
+ * @file
+ */
+#ifndef CONGURE_CUBIC_H
+#define CONGURE_CUBIC_H
+
+#include <stdint.h>
+
+#include "congure/reno.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   State object for CongURE CUBIC
+ *
+ * @extends congure_reno_snd_t
+ */
+typedef struct {
+    congure_reno_snd_t super;       /**< see @ref congure_reno_snd_t */
+    congure_wnd_size_t w_max;       /**< Window size before the last reduction */
+    /**
+     * @brief   Window size before the reduction preceding the last one, for
+     *          fast convergence
+     */
+    congure_wnd_size_t w_last_max;
+    /**
+     * @brief   Estimated window size of a standard TCP in the current epoch
+     */
+    congure_wnd_size_t w_est;
+    /**
+     * @brief   Time in milliseconds the window takes to grow to
+     *          congure_cubic_snd_t::w_max in the current epoch
+     */
+    uint32_t k;
+    /**
+     * @brief   Start of the current congestion avoidance epoch in
+     *          milliseconds. 0 if no epoch was started yet.
+     */
+    ztimer_now_t epoch_start;
+    /**
+     * @brief   Minimum observed round-trip time in milliseconds. 0 if no
+     *          sample was taken yet.
+     */
+    uint32_t rtt_min;
+} congure_cubic_snd_t;
+
+/**
+ * @brief   Sets up the driver for a CongURE CUBIC object
+ *
+ * @pre @p mss > 0
+ *
+ * @param[out] c        A CongURE CUBIC object.
+ * @param[in] mss       Maximum size of a message in caller-defined unit.
+ *                      The initial window is derived from it when
+ *                      congure_snd_driver_t::init() is called.
+ */
+void congure_cubic_snd_setup(congure_cubic_snd_t *c, unsigned mss);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONGURE_CUBIC_H */
+/** @} */
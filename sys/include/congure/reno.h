@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_congure_reno    CongURE implementation of TCP Reno
+ * @ingroup     sys_congure
+ * @brief       Implementation of the TCP Reno congestion control mechanism
+ *              for @ref sys_congure
+ *
+ * Implements slow start, congestion avoidance and the reaction to loss and
+ * timeouts as specified in [RFC 5681](https://tools.ietf.org/html/rfc5681).
+ * All sizes are in the unit chosen by the caller, typically bytes.
+ *
+ * The caller detects losses, e.g. by counting duplicate ACKs, and reports them
+ * via congure_snd_driver_t::report_msgs_lost(). As duplicate ACKs are not
+ * reported to the driver, the window is not inflated during fast recovery,
+ * but set to the slow start threshold right away.
+ * @{
+ *
+ * @file
+ */
+#ifndef CONGURE_RENO_H
+#define CONGURE_RENO_H
+
+#include "congure.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   State object for CongURE Reno
+ *
+ * @extends congure_snd_t
+ */
+typedef struct {
+    congure_snd_t super;                /**< see @ref congure_snd_t */
+    congure_wnd_size_t mss;             /**< Maximum message size */
+    congure_wnd_size_t ssthresh;        /**< Slow start threshold */
+    /**
+     * @brief   Sum of the sizes of all sent, but not yet acknowledged or
+     *          discarded messages
+     */
+    congure_wnd_size_t in_flight_size;
+} congure_reno_snd_t;
+
+/**
+ * @brief   Sets up the driver for a CongURE Reno object
+ *
+ * @pre @p mss > 0
+ *
+ * @param[out] c        A CongURE Reno object.
+ * @param[in] mss       Maximum size of a message in caller-defined unit.
+ *                      The initial window is derived from it when
+ *                      congure_snd_driver_t::init() is called.
+ */
+void congure_reno_snd_setup(congure_reno_snd_t *c, unsigned mss);
+
+/**
+ * @brief   Calculates the initial window
+ *
+ * @see     [RFC 5681, section 3.1](https://tools.ietf.org/html/rfc5681#section-3.1)
+ *
+ * @param[in] mss       Maximum size of a message in caller-defined unit.
+ *
+ * @return  The initial window of 2 to 4 times @p mss.
+ */
+congure_wnd_size_t congure_reno_snd_init_wnd(unsigned mss);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONGURE_RENO_H */
+/** @} */
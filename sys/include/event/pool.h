@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Provides a pool of worker threads sharing the handling of events
+ *
+ * An event handler thread (see @ref event_thread_init()) handles one event at
+ * a time: if a handler blocks, e.g. waiting for a bus transfer or sleeping,
+ * all events posted to its queue pile up behind it. An event pool instead
+ * distributes the events posted with @ref event_pool_post() among a set of
+ * worker threads:
+ *
+ * - events are posted to an idle worker, if there is one, otherwise to the
+ *   workers in turn
+ * - a worker that ran out of events takes (steals) the oldest event queued
+ *   at another worker before going to sleep
+ *
+ * All workers run at the same priority, so workers only take over events
+ * of a worker that is blocked (or preempted with `sched_round_robin`).
+ * Events posted to a pool may therefore run concurrently and in any order.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * #define WORKERS_NUMOF    (4)
+ *
+ * static char _stacks[WORKERS_NUMOF][THREAD_STACKSIZE_DEFAULT];
+ * static event_pool_worker_t _workers[WORKERS_NUMOF];
+ * static event_pool_t _pool;
+ *
+ * [...]
+ * event_pool_init(&_pool, _workers, WORKERS_NUMOF, _stacks[0],
+ *                 sizeof(_stacks[0]), THREAD_PRIORITY_MAIN - 1);
+ * event_pool_post(&_pool, &event);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event Pool API
+ */
+
+#ifndef EVENT_POOL_H
+#define EVENT_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Forward declaration of the event pool
+ */
+typedef struct event_pool event_pool_t;
+
+/**
+ * @brief   Worker thread of an event pool
+ */
+typedef struct {
+    event_queue_t queue;        /**< events posted to this worker */
+    event_pool_t *pool;         /**< pool the worker belongs to */
+    bool idle;                  /**< worker waits for events */
+} event_pool_worker_t;
+
+/**
+ * @brief   Event pool structure
+ */
+struct event_pool {
+    event_pool_worker_t *workers;   /**< array of workers */
+    unsigned numof;                 /**< number of workers */
+    unsigned next;                  /**< worker to post to if none is idle */
+};
+
+/**
+ * @brief   Initialize an event pool and start its worker threads
+ *
+ * @param[out]  pool        pool to initialize
+ * @param[out]  workers     preallocated array of @p numof workers
+ * @param[in]   numof       number of worker threads to start
+ * @param[in]   stacks      stack space for all workers, @p numof times
+ *                          @p stack_size bytes
+ * @param[in]   stack_size  stack size of each worker, must be a multiple of
+ *                          the stack alignment
+ * @param[in]   priority    priority of the worker threads
+ */
+void event_pool_init(event_pool_t *pool, event_pool_worker_t *workers,
+                     unsigned numof, char *stacks, size_t stack_size,
+                     uint8_t priority);
+
+/**
+ * @brief   Queue an event to be handled by one of the workers of a pool
+ *
+ * Like @ref event_post(), posting an event that is already queued does
+ * nothing.
+ *
+ * @param[in]   pool        pool to post to
+ * @param[in]   event       event to queue
+ */
+void event_pool_post(event_pool_t *pool, event_t *event);
+
+/**
+ * @brief   Remove an event from a pool, if it has not been handled yet
+ *
+ * @param[in]   pool        pool the event was posted to
+ * @param[in]   event       event to remove
+ */
+void event_pool_cancel(event_pool_t *pool, event_t *event);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_POOL_H */
+/** @} */
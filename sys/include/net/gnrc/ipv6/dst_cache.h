@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_ipv6_dst_cache IPv6 destination cache
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Caches the next hop and source address per destination
+ *
+ * For every unicast packet, @ref net_gnrc_ipv6 asks the NIB for the next hop
+ * and its link-layer address and selects a source address for packets
+ * without one. For a steady flow to the same peer this yields the same result
+ * every time. With this module, the IPv6 thread keeps the results for the
+ * last @ref CONFIG_GNRC_IPV6_DST_CACHE_SIZE destinations and skips both
+ * lookups for packets to one of them.
+ *
+ * Only next hops in the neighbor cache states
+ * @ref GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE and
+ * @ref GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED are cached, so neighbor
+ * unreachability detection is not bypassed. All entries are invalidated
+ * whenever a route or prefix is added or removed, a cached neighbor leaves
+ * these states or changes its link-layer address, or a neighbor is removed.
+ * Neighbor discovery messages and timer events that do not change the NIB
+ * keep the entries. A cached source address is only used while it is still
+ * assigned to the interface.
+ *
+ * The hit rate can be checked with @ref gnrc_ipv6_dst_cache_stats_get().
+ *
+ * @note    This is not the destination cache of the NIB
+ *          (@ref CONFIG_GNRC_IPV6_NIB_DC), which stores redirects.
+ *
+ * @{
+ *
+ * @file
+ * @brief   IPv6 destination cache definitions
+ */
+#ifndef NET_GNRC_IPV6_DST_CACHE_H
+#define NET_GNRC_IPV6_DST_CACHE_H
+
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/ipv6/addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    net_gnrc_ipv6_dst_cache_conf GNRC IPv6 destination cache compile configurations
+ * @ingroup     net_gnrc_ipv6_dst_cache
+ * @ingroup     net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of destinations to cache
+ */
+#ifndef CONFIG_GNRC_IPV6_DST_CACHE_SIZE
+#define CONFIG_GNRC_IPV6_DST_CACHE_SIZE    (4)
+#endif
+/** @} */
+
+/**
+ * @brief   Destination cache entry
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination address */
+    /**
+     * @brief   source address selected for @ref gnrc_ipv6_dst_cache_t::dst,
+     *          unspecified if not selected yet
+     */
+    ipv6_addr_t src;
+    gnrc_ipv6_nib_nc_t nce;     /**< next hop, its interface and L2 address */
+    uint32_t version;           /**< cache version the entry is valid for */
+    unsigned iface;             /**< interface requested by the sender or 0 */
+} gnrc_ipv6_dst_cache_t;
+
+/**
+ * @brief   Destination cache statistics
+ */
+typedef struct {
+    uint32_t hits;              /**< lookups answered from the cache */
+    uint32_t misses;            /**< lookups that needed to ask the NIB */
+} gnrc_ipv6_dst_cache_stats_t;
+
+#if IS_USED(MODULE_GNRC_IPV6_DST_CACHE) || defined(DOXYGEN)
+/**
+ * @brief   Gets the current version of the cache
+ *
+ * Needs to be called before asking the NIB for an entry to be added with
+ * @ref gnrc_ipv6_dst_cache_add(), so that a change of the NIB in between
+ * invalidates the new entry.
+ *
+ * @return  version of the cache
+ */
+uint32_t gnrc_ipv6_dst_cache_version(void);
+
+/**
+ * @brief   Looks up a destination
+ *
+ * @note    Only to be called by the IPv6 thread.
+ *
+ * @param[in] dst   destination address
+ * @param[in] iface interface requested by the sender, 0 for any
+ *
+ * @return  the valid entry for @p dst and @p iface
+ * @return  NULL, if there is none
+ */
+gnrc_ipv6_dst_cache_t *gnrc_ipv6_dst_cache_get(const ipv6_addr_t *dst,
+                                               unsigned iface);
+
+/**
+ * @brief   Adds the result of a next hop lookup to the cache
+ *
+ * Replaces an entry for the same destination or an invalidated entry, the
+ * oldest entry otherwise. Next hops that are not in state
+ * @ref GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE or
+ * @ref GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED are not added.
+ *
+ * @note    Only to be called by the IPv6 thread.
+ *
+ * @param[in] dst       destination address
+ * @param[in] iface     interface requested by the sender, 0 for any
+ * @param[in] nce       next hop as returned by
+ *                      @ref gnrc_ipv6_nib_get_next_hop_l2addr()
+ * @param[in] version   return value of @ref gnrc_ipv6_dst_cache_version()
+ *                      before @p nce was looked up
+ *
+ * @return  the new entry, with unspecified gnrc_ipv6_dst_cache_t::src
+ * @return  NULL, if @p nce was not added
+ */
+gnrc_ipv6_dst_cache_t *gnrc_ipv6_dst_cache_add(const ipv6_addr_t *dst,
+                                               unsigned iface,
+                                               const gnrc_ipv6_nib_nc_t *nce,
+                                               uint32_t version);
+
+/**
+ * @brief   Invalidates all entries
+ *
+ * Called by the NIB whenever a change of a route, prefix or neighbor might
+ * affect the next hop or the interface of a destination. May be called from
+ * any thread.
+ */
+void gnrc_ipv6_dst_cache_invalidate(void);
+
+/**
+ * @brief   Gets the cache statistics
+ *
+ * @param[out] stats    hits and misses since boot
+ */
+void gnrc_ipv6_dst_cache_stats_get(gnrc_ipv6_dst_cache_stats_t *stats);
+#else
+static inline void gnrc_ipv6_dst_cache_invalidate(void)
+{
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_IPV6_DST_CACHE_H */
+/** @} */
@@ -184,6 +184,26 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * @brief   Index the neighbor cache and the off-link entries
+ *
+ * Replaces the linear searches done for every forwarded packet with hash
+ * table lookups: on-link entries are found by address in constant time, the
+ * longest prefix match over off-link entries (forwarding table and prefix
+ * list) takes one lookup per prefix length in use. Costs about 12 bytes of
+ * RAM per entry (see @ref CONFIG_GNRC_IPV6_NIB_NUMOF and
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF), so it is only worth it for larger
+ * tables, e.g. on border routers.
+ *
+ * @note    With the index, the forwarding table always prefers the entry
+ *          with the longest prefix. Without it, entries with shorter prefixes
+ *          are considered equal if the destination happens to also match the
+ *          zero bits following their prefix.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_INDEX
+#define CONFIG_GNRC_IPV6_NIB_INDEX                    0
+#endif
+
 /**
  * @brief   Support for DNS configuration options
  *
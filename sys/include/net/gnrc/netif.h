@@ -183,6 +183,15 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Received packets not passed up yet
+     *
+     * @note    Only available with @ref net_gnrc_netif_rx_batch.
+     */
+    gnrc_pktsnip_t *rx_batch[CONFIG_GNRC_NETIF_RX_BATCH_SIZE];
+    uint8_t rx_batch_len;                   /**< number of packets in gnrc_netif_t::rx_batch */
 #endif
     uint8_t cur_hl;                         /**< Current hop-limit for out-going packets */
     uint8_t device_type;                    /**< Device type */
@@ -78,6 +78,33 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Number of flow queues per network interface
+ *
+ * @see         net_gnrc_netif_pktq_fq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS       (4U)
+#endif
+
+/**
+ * @brief       Bytes a flow queue may send per round
+ *
+ * @see         net_gnrc_netif_pktq_fq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM     (256U)
+#endif
+
+/**
+ * @brief       Maximum number of received packets passed up in one batch
+ *
+ * @see         net_gnrc_netif_rx_batch
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_BATCH_SIZE
+#define CONFIG_GNRC_NETIF_RX_BATCH_SIZE       (8U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
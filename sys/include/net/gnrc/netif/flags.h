@@ -135,6 +135,26 @@ enum {
  */
 #define GNRC_NETIF_FLAGS_6LO                       (0x00002000U)
 
+/**
+ * @brief   Device inserts the upper-layer checksums of outgoing IPv6 packets
+ *
+ * @see     @ref NETOPT_TX_CSUM_OFFLOAD
+ *
+ * @note    Set on initialization, if the device supports it. Ignored while
+ *          6Lo is active.
+ */
+#define GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD           (0x00004000U)
+
+/**
+ * @brief   Device only passes up IPv6 packets with valid upper-layer checksums
+ *
+ * @see     @ref NETOPT_RX_CSUM_VALID
+ *
+ * @note    Set on initialization, if the device supports it. Ignored while
+ *          6Lo is active.
+ */
+#define GNRC_NETIF_FLAGS_RX_CSUM_VALID             (0x00008000U)
+
 /**
  * @brief   Network interface is configured in raw mode
  */
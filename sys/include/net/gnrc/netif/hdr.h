@@ -112,6 +112,15 @@ extern "C" {
  *          can be used to check for presence of a valid timestamp.
  */
 #define GNRC_NETIF_HDR_FLAGS_TIMESTAMP  (0x08)
+
+/**
+ * @brief   The packet was reassembled from fragments by the node
+ *
+ * @details The header is the one of a single fragment, so checks the device
+ *          did on the received frame (e.g. @ref NETOPT_RX_CSUM_VALID) do not
+ *          apply to the packet.
+ */
+#define GNRC_NETIF_HDR_FLAGS_REASSEMBLED    (0x04)
 /**
  * @}
  */
@@ -400,6 +400,41 @@ static inline bool gnrc_netif_is_6lo(const gnrc_netif_t *netif)
     }
 }
 
+/**
+ * @brief   Checks if the device of the interface inserts the upper-layer
+ *          checksums of outgoing IPv6 packets
+ *
+ * @param[in] netif the network interface
+ *
+ * @see     @ref GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD
+ *
+ * @return  true, if the checksums do not need to be calculated
+ * @return  false, if the checksums need to be calculated
+ */
+static inline bool gnrc_netif_tx_csum_offloaded(const gnrc_netif_t *netif)
+{
+    /* with 6Lo, the device only sees the compressed headers */
+    return (netif->flags & GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD) &&
+           !gnrc_netif_is_6lo(netif);
+}
+
+/**
+ * @brief   Checks if the device of the interface only passes up IPv6 packets
+ *          with valid upper-layer checksums
+ *
+ * @param[in] netif the network interface
+ *
+ * @see     @ref GNRC_NETIF_FLAGS_RX_CSUM_VALID
+ *
+ * @return  true, if the checksums do not need to be verified
+ * @return  false, if the checksums need to be verified
+ */
+static inline bool gnrc_netif_rx_csum_valid(const gnrc_netif_t *netif)
+{
+    return (netif->flags & GNRC_NETIF_FLAGS_RX_CSUM_VALID) &&
+           !gnrc_netif_is_6lo(netif);
+}
+
 /**
  * @brief   Checks if the interface represents a 6Lo node (6LN) according to
  *          RFC 6775
@@ -24,6 +24,7 @@
 #include <stdbool.h>
 
 #include "net/gnrc/netif.h"
+#include "net/gnrc/netif/pktq/fq.h"
 #include "net/gnrc/netif/pktq/type.h"
 #include "net/gnrc/pkt.h"
 
@@ -40,6 +41,9 @@ extern "C" {
  * @param[in] netif A network interface. May not be NULL.
  * @param[in] pkt   A packet. May not be NULL.
  *
+ * With @ref net_gnrc_netif_pktq_fq, a packet of a longer flow queue might be
+ * dropped to make room for @p pkt.
+ *
  * @return  0 on success
  * @return  -1 when the pool of available gnrc_pktqueue_t entries (of size
  *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted
@@ -65,7 +69,9 @@ unsigned gnrc_netif_pktq_usage(void);
  */
 static inline gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
 {
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    return gnrc_netif_pktq_fq_get(netif);
+#elif IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
     gnrc_pktsnip_t *pkt = NULL;
@@ -127,7 +133,16 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
  */
 static inline bool gnrc_netif_pktq_empty(gnrc_netif_t *netif)
 {
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    assert(netif != NULL);
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS; i++) {
+        if (netif->send_queue.flows[i].queue != NULL) {
+            return false;
+        }
+    }
+    return true;
+#elif IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
     return (netif->send_queue.queue == NULL);
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_netif_pktq_fq Fair queueing for the send queue
+ * @ingroup     net_gnrc_netif_pktq
+ * @brief       Deficit round robin over flow-hashed queues for
+ *              @ref net_gnrc_netif_pktq
+ *
+ * Without this module, the send queue of a network interface is a single
+ * FIFO, so a flow sending many packets, e.g. a firmware update, delays all
+ * other packets queued behind it. With this module, each interface has
+ * @ref CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS queues. A packet is put into a queue
+ * by a hash over
+ *
+ * - the link-layer destination from the @ref gnrc_netif_hdr_t,
+ * - and, if the packet carries an uncompressed IPv6 header, the source and
+ *   destination address, the next header and the first four bytes after the
+ *   IPv6 header, i.e. the ports of UDP and TCP.
+ *
+ * With 6LoWPAN, the IPv6 header is already compressed when the packet is
+ * queued, so flows are only told apart by their link-layer destination.
+ *
+ * The queues are served by deficit round robin: each round, a queue may send
+ * up to @ref CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM bytes, so every flow gets the
+ * same share of the link, independent of its packet sizes. Packets of the
+ * same flow are sent in order.
+ *
+ * All queues share the entries of @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE.
+ * When they are depleted, the last packet of the longest queue is dropped for
+ * a packet of a shorter queue, so a bulk flow can not lock out other flows.
+ *
+ * Per-flow statistics are available with @ref NETOPT_STATS and the context
+ * @ref NETSTATS_PKTQ_FQ. The option returns a pointer to the
+ * @ref netstats_fq_t of the first of the
+ * @ref CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS flows.
+ *
+ * @{
+ *
+ * @file
+ * @brief   @ref net_gnrc_netif_pktq_fq definitions
+ */
+#ifndef NET_GNRC_NETIF_PKTQ_FQ_H
+#define NET_GNRC_NETIF_PKTQ_FQ_H
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Gets the index of the flow queue of a packet
+ *
+ * @param[in] pkt   A packet to send, starting with its @ref gnrc_netif_hdr_t
+ *
+ * @return  index into gnrc_netif_pktq_t::flows
+ */
+unsigned gnrc_netif_pktq_fq_flow(const gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Gets the next packet by deficit round robin
+ *
+ * @note    Use @ref gnrc_netif_pktq_get() instead.
+ *
+ * @param[in] netif A network interface. May not be NULL.
+ *
+ * @return  A packet on success
+ * @return  NULL when all queues are empty
+ */
+gnrc_pktsnip_t *gnrc_netif_pktq_fq_get(gnrc_netif_t *netif);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_PKTQ_FQ_H */
+/** @} */
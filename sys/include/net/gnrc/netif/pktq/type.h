@@ -23,18 +23,48 @@
 #ifndef NET_GNRC_NETIF_PKTQ_TYPE_H
 #define NET_GNRC_NETIF_PKTQ_TYPE_H
 
+#include <stdint.h>
+
+#include "net/gnrc/netif/conf.h"
 #include "net/gnrc/pktqueue.h"
+#include "net/netstats.h"
 #include "xtimer.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   A flow queue of @ref net_gnrc_netif_pktq_fq
+ */
+typedef struct {
+    gnrc_pktqueue_t *queue;     /**< the packets of the flow */
+    int32_t deficit;            /**< bytes the flow may still send this round */
+} gnrc_netif_pktq_flow_t;
+
 /**
  * @brief   A packet queue for @ref net_gnrc_netif with a de-queue timer
  */
 typedef struct {
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) || defined(DOXYGEN)
+    /**
+     * @brief   The flow queues
+     *
+     * @note    Only available with @ref net_gnrc_netif_pktq_fq, replaces
+     *          gnrc_netif_pktq_t::queue.
+     */
+    gnrc_netif_pktq_flow_t flows[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS];
+    /**
+     * @brief   Statistics of gnrc_netif_pktq_t::flows
+     *
+     * @note    Only available with @ref net_gnrc_netif_pktq_fq.
+     */
+    netstats_fq_t flow_stats[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS];
+    uint8_t cur;                /**< index of the flow currently served */
+#endif
+#if !IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) || defined(DOXYGEN)
     gnrc_pktqueue_t *queue;     /**< the actual packet queue class */
+#endif
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
     msg_t dequeue_msg;          /**< message for gnrc_netif_pktq_t::dequeue_timer to send */
     xtimer_t dequeue_timer;     /**< timer to schedule next sending of
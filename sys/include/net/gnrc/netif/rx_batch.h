@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_netif_rx_batch Receive batching for @ref net_gnrc_netif
+ * @ingroup     net_gnrc_netif
+ * @brief       Passes received packets up the network stack in batches
+ *
+ * By default, a network interface dispatches every received packet with its
+ * own @ref GNRC_NETAPI_MSG_TYPE_RCV message. With this module, it collects the
+ * packets of all pending receive events of the device, up to
+ * @ref CONFIG_GNRC_NETIF_RX_BATCH_SIZE, and passes consecutive packets of the
+ * same type up with a single @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message. The
+ * batch is passed up as soon as it is full or the interface has no more events
+ * or messages to handle, so single packets are not delayed.
+ *
+ * Under load, this saves IPC messages and keeps bursts of frames, e.g. from
+ * an Ethernet uplink, from overflowing the message queue of the receiving
+ * thread.
+ *
+ * Batches are only sent to @ref net_gnrc_ipv6 and @ref net_gnrc_sixlowpan, and
+ * only if that thread is the only one registered for the packet type.
+ * Otherwise, the packets are dispatched one by one as before.
+ *
+ * @{
+ *
+ * @file
+ * @brief   @ref net_gnrc_netif_rx_batch definitions
+ */
+#ifndef NET_GNRC_NETIF_RX_BATCH_H
+#define NET_GNRC_NETIF_RX_BATCH_H
+
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Handles the packets of a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+ *          message and releases the batch
+ *
+ * @param[in] batch     content of the message
+ * @param[in] receive   handler for a single received packet
+ */
+static inline void gnrc_netif_rx_batch_handle(gnrc_pktsnip_t *batch,
+                                              void (*receive)(gnrc_pktsnip_t *))
+{
+    gnrc_pktsnip_t **pkts = batch->data;
+
+    for (unsigned i = 0; i < (batch->size / sizeof(*pkts)); i++) {
+        receive(pkts[i]);
+    }
+    gnrc_pktbuf_release(batch);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_RX_BATCH_H */
+/** @} */
@@ -35,6 +35,26 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup    net_gnrc_netreg_conf GNRC network protocol registry compile configurations
+ * @ingroup     net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per @ref gnrc_nettype_t
+ *
+ * Entries of one type are spread over this many lists by their
+ * @ref gnrc_netreg_entry_t::demux_ctx (e.g. the UDP port), so a lookup only
+ * searches the entries that share a bucket with the requested context. With
+ * the default of 1, all entries of a type are in a single list. Raise this on
+ * nodes with many registered sockets, at the cost of one pointer per bucket
+ * and type.
+ */
+#ifndef CONFIG_GNRC_NETREG_BUCKETS
+#define CONFIG_GNRC_NETREG_BUCKETS  (1U)
+#endif
+/** @} */
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
     defined(DOXYGEN)
 /**
@@ -63,6 +63,55 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Use segregated size classes and best fit in the static packet
+ *          buffer
+ *
+ * @details By default, the static packet buffer allocates from the first
+ *          free section large enough (first fit). With this option, chunks
+ *          up to @ref CONFIG_GNRC_PKTBUF_SIZE_CLASS_MAX bytes (e.g. snip
+ *          descriptors and protocol headers) are cut from the end of the
+ *          last free section large enough, so they gather at the end of the
+ *          packet buffer instead of splitting up the space needed for
+ *          payloads. Larger chunks are taken from the smallest free section
+ *          they fit in (best fit).
+ *
+ *          Optionally, up to @ref CONFIG_GNRC_PKTBUF_SIZE_CLASS_DEPTH freed
+ *          small chunks per size are kept in a list for that size and handed
+ *          out again in O(1) time. They are merged back into the free
+ *          sections when an allocation fails otherwise.
+ *
+ *          Use `tests/gnrc_pktbuf_static_stress` and @ref gnrc_pktbuf_stats()
+ *          to compare both allocators for a given traffic pattern.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZE_CLASSES
+#define CONFIG_GNRC_PKTBUF_SIZE_CLASSES     0
+#endif
+
+/**
+ * @brief   Largest chunk size in bytes with its own size class
+ *
+ * @see     CONFIG_GNRC_PKTBUF_SIZE_CLASSES
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZE_CLASS_MAX
+#define CONFIG_GNRC_PKTBUF_SIZE_CLASS_MAX   (64U)
+#endif
+
+/**
+ * @brief   Maximum number of freed chunks kept per size class
+ *
+ * @details Kept chunks are not merged with neighboring free space, so larger
+ *          values speed up the allocation of small chunks, but fragment the
+ *          packet buffer more. They are merged back before an allocation
+ *          fails. 0 (the default) disables keeping freed chunks, so no
+ *          buffer space is held back from allocations of other sizes.
+ *
+ * @see     CONFIG_GNRC_PKTBUF_SIZE_CLASSES
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZE_CLASS_DEPTH
+#define CONFIG_GNRC_PKTBUF_SIZE_CLASS_DEPTH (0U)
+#endif
 /** @} */
 
 /**
@@ -285,7 +334,9 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes and, for the
+ *          static packet buffer, the fragmentation of the free space and the
+ *          number of failed allocations.
  */
 void gnrc_pktbuf_stats(void);
 #endif
@@ -165,6 +165,15 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US  (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US */
 
+/**
+ * @brief   Number of flows the IPHC address compression is cached for
+ *
+ * @note    Only applicable with the `gnrc_sixlowpan_iphc_cache` module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE      (4U)
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE */
+
 /**
  * @name Selective fragment recovery configuration
  * @see  [RFC 8931, section 7.1]
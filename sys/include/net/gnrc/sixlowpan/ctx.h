@@ -113,17 +113,26 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
                                                 uint8_t prefix_len, uint16_t ltime,
                                                 bool comp);
 
-#ifdef MODULE_GNRC_SIXLOWPAN_CTX
 /**
  * @brief   Removes context.
  *
- * @param[in] id    A context ID.
+ * @note    May be called from interrupt context.
+ *
+ * @param[in] id    A context ID. Must be < @ref GNRC_SIXLOWPAN_CTX_SIZE.
  */
-static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
-{
-    gnrc_sixlowpan_ctx_lookup_id(id)->prefix_len = 0;
-}
-#endif
+void gnrc_sixlowpan_ctx_remove(uint8_t id);
+
+/**
+ * @brief   Gets the generation of the context buffer
+ *
+ * The generation changes whenever the result of
+ * @ref gnrc_sixlowpan_ctx_lookup_addr() may have changed since the last call,
+ * i.e. on updates and removals and when lifetimes may have expired. This
+ * allows to cache results derived from the contexts.
+ *
+ * @return  The current generation.
+ */
+uint16_t gnrc_sixlowpan_ctx_generation(void);
 
 #ifdef TEST_SUITES
 /**
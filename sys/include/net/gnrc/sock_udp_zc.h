@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sock_udp_zc Zero-copy UDP sock send
+ * @ingroup     net_gnrc
+ * @brief       Sends UDP payload from application memory without copying it
+ *              into the packet buffer
+ *
+ * @ref sock_udp_send() copies the payload into the packet buffer before it
+ * goes down the stack. @ref sock_udp_sendv_zc() instead references the
+ * payload chunks from the packet, so network interfaces that hand the packet
+ * to the device as @ref iolist_t pass the application memory to the driver
+ * directly. The memory must not be changed until the callback given to
+ * @ref sock_udp_sendv_zc() was called, i.e. until the stack released the
+ * packet.
+ *
+ * Where the stack needs the payload in one piece, e.g. for 6LoWPAN
+ * fragmentation or for packets looped back to the node itself, it is still
+ * copied.
+ *
+ * This module uses @ref net_gnrc_tx_sync for the completion callback, so
+ * @ref sock_udp_send() waits for the transmission to complete as well. Only
+ * the zero-copy send returns without waiting. It only works with the static
+ * packet buffer, which does not free data outside of its buffer.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Zero-copy UDP sock send definitions
+ */
+#ifndef NET_GNRC_SOCK_UDP_ZC_H
+#define NET_GNRC_SOCK_UDP_ZC_H
+
+#include <sys/types.h>
+
+#include "iolist.h"
+#include "net/gnrc/tx_sync.h"
+#include "net/sock/udp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Context of a zero-copy send
+ *
+ * Needs to stay valid until the completion callback was called.
+ */
+typedef struct {
+    gnrc_tx_sync_t tx_sync;     /**< signals the release of the payload */
+} sock_udp_zc_t;
+
+/**
+ * @brief   Sends a UDP message from application memory to remote end point
+ *
+ * @pre `((sock != NULL || remote != NULL)) && (zc != NULL) && (cb != NULL)`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] snips     Chunks of the payload. Only the memory the chunks point
+ *                      to needs to stay valid until @p cb was called, the list
+ *                      itself may be reused after the function returns.
+ *                      May be `NULL` for an empty payload.
+ * @param[in] remote    Remote end point for the sent data.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ *                      sock_udp_ep_t::family may be AF_UNSPEC, if local
+ *                      end point of @p sock provides this information.
+ *                      sock_udp_ep_t::port may not be 0.
+ * @param[out] zc       Context of the send
+ * @param[in] cb        Called with @p arg once the stack released the payload,
+ *                      e.g. after the driver transmitted it. It is called from
+ *                      the thread releasing the packet, typically a network
+ *                      interface thread, with the packet buffer locked. So it
+ *                      must not call any sock or packet buffer function.
+ * @param[in] arg       Argument for @p cb
+ *
+ * @return  The number of bytes sent on success. @p cb will be called.
+ * @return  -EADDRINUSE, if `sock` has no local end-point or was `NULL` and the
+ *          pool of available ephemeral ports is depleted.
+ * @return  -EAFNOSUPPORT, if `remote != NULL` and sock_udp_ep_t::family of
+ *          @p remote is != AF_UNSPEC and not supported.
+ * @return  -EINVAL, if sock_udp_ep_t::addr of @p remote is an invalid address.
+ * @return  -EINVAL, if sock_udp_ep_t::netif of @p remote is not a valid
+ *          interface or contradicts the given local interface.
+ * @return  -EINVAL, if sock_udp_ep_t::port of @p remote is 0.
+ * @return  -ENOMEM, if no memory was available to send the packet.
+ * @return  -ENOTCONN, if `remote == NULL`, but @p sock has no remote end point.
+ * @return  On any error @p cb is not called and the payload memory may be
+ *          reused right away.
+ */
+ssize_t sock_udp_sendv_zc(sock_udp_t *sock, const iolist_t *snips,
+                          const sock_udp_ep_t *remote, sock_udp_zc_t *zc,
+                          gnrc_tx_sync_cb_t cb, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SOCK_UDP_ZC_H */
+/** @} */
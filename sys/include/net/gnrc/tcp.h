@@ -11,6 +11,56 @@
  * @ingroup     net_gnrc
  * @brief       RIOT's TCP implementation for the GNRC network stack.
  *
+ * Congestion control
+ * ==================
+ *
+ * By default, the amount of data in flight is only limited by the window of
+ * the peer and @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE. To additionally
+ * limit it by a congestion window, select a @ref sys_congure implementation:
+ *
+ * - `gnrc_tcp_congure_reno`: @ref sys_congure_reno (the default of
+ *   `gnrc_tcp_congure`)
+ * - `gnrc_tcp_congure_cubic`: @ref sys_congure_cubic
+ *
+ * e.g. with
+ *
+ * ```Makefile
+ * USEMODULE += gnrc_tcp_congure_cubic
+ * ```
+ *
+ * Loss recovery
+ * =============
+ *
+ * Window scaling (RFC 7323) and selective acknowledgments (RFC 2018) are
+ * negotiated with every peer. Up to @ref CONFIG_GNRC_TCP_RCV_OOO_SIZE segments
+ * received behind a gap are kept and reported to the peer, so only the missing
+ * segments are retransmitted. As a sender, each hole reported by the peer is
+ * retransmitted as soon as the previous one was acknowledged.
+ *
+ * Sock API
+ * ========
+ *
+ * With `sock_tcp`, connections are also available via @ref net_sock_tcp. With
+ * `sock_async_event` additionally, a single thread can serve many connections
+ * through @ref net_sock_async_event:
+ *
+ * - A listening queue reports `SOCK_ASYNC_CONN_RECV` when a connection can be
+ *   accepted without blocking.
+ * - A connection reports `SOCK_ASYNC_MSG_RECV` when data or the end of the
+ *   stream can be read, `SOCK_ASYNC_MSG_SENT` when the peer acknowledged data
+ *   or changed its window and `SOCK_ASYNC_CONN_FIN` when the peer closed or
+ *   reset the connection.
+ *
+ * Callbacks are always called from the TCP thread, also for events caused by
+ * a gnrc_tcp or sock_tcp call of another thread. They must neither block nor
+ * call blocking gnrc_tcp or sock_tcp functions, which would wait for the TCP
+ * thread. With `sock_async_event`, the callbacks only post events and the
+ * handlers run in the thread of the event queue, where this does not apply.
+ *
+ * The callbacks of an accepted connection must be set after
+ * sock_tcp_accept(). Data that arrived before they were set raises no event,
+ * so read from the connection once right after setting them.
+ *
  * @{
  *
  * @file
@@ -183,6 +233,11 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       Transmitted data is copied into the packet buffer and retransmitted
+ *       until the peer acknowledges it, so this function returns without
+ *       waiting for the acknowledgment. At most
+ *       @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE segments are awaiting
+ *       their acknowledgment at any time.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
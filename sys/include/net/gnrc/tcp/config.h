@@ -108,6 +108,30 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Maximum number of unacknowledged data segments in flight
+ *
+ * Segments are sent as long as the send window of the peer allows it and
+ * fewer than this number of segments are awaiting their acknowledgment. Each
+ * of them is kept in the packet buffer until it is acknowledged. A value of 1
+ * results in stop-and-wait.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Maximum number of out-of-order segments kept per connection
+ *
+ * Segments that arrive behind a gap in the sequence space are kept in the
+ * packet buffer, reported to the peer by selective acknowledgments and
+ * copied into the receive buffer once the gap is filled. Only segments
+ * inside the receive window are kept.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_OOO_SIZE
+#define CONFIG_GNRC_TCP_RCV_OOO_SIZE (4U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
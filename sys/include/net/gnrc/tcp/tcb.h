@@ -17,6 +17,13 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+/* The asynchronous sock types include sock_types.h, which embeds the TCB.
+ * They must be complete before the TCB is defined, so include them ahead of
+ * the include guard. */
+#if defined(MODULE_GNRC_SOCK_TCP) && defined(SOCK_HAS_ASYNC)
+#include "net/sock/async/types.h"
+#endif
+
 #ifndef NET_GNRC_TCP_TCB_H
 #define NET_GNRC_TCP_TCB_H
 
@@ -34,6 +41,12 @@
 #include "net/gnrc/ipv6.h"
 #endif
 
+#if defined(MODULE_GNRC_TCP_CONGURE_CUBIC)
+#include "congure/cubic.h"
+#elif defined(MODULE_GNRC_TCP_CONGURE_RENO)
+#include "congure/reno.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -54,28 +67,64 @@ typedef struct _transmission_control_block {
     uint8_t status;        /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
-    uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
-    uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
+    uint8_t snd_wnd_scale; /**< Shift count of the peers window */
+    uint32_t snd_sack_high; /**< Highest SeqNo. selectively acknowledged by the peer */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
+    uint32_t rtt_seq;      /**< SeqNo. acknowledging the timed segment */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t dup_acks;      /**< Number of duplicate ACKs received */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    /**
+     * @brief Unacknowledged segments in order of their sequence numbers
+     *
+     * There is one additional entry for a FIN following a full window.
+     */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE + 1];
+    uint8_t pkt_retransmit_len;           /**< Number of entries in pkt_retransmit */
+#ifdef MODULE_GNRC_TCP_CONGURE
+    /**
+     * @brief Time in milliseconds the entries of pkt_retransmit were last sent
+     */
+    uint32_t pkt_retransmit_time[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE + 1];
+#endif
+#if defined(MODULE_GNRC_TCP_CONGURE_CUBIC)
+    congure_cubic_snd_t congure;          /**< Congestion control state */
+#elif defined(MODULE_GNRC_TCP_CONGURE_RENO)
+    congure_reno_snd_t congure;           /**< Congestion control state */
+#endif
+    /**
+     * @brief Segments received behind a gap in order of their sequence numbers
+     */
+    gnrc_pktsnip_t *rcv_ooo[CONFIG_GNRC_TCP_RCV_OOO_SIZE];
+    uint8_t rcv_ooo_len;     /**< Number of entries in rcv_ooo */
+    uint32_t rcv_ooo_last;   /**< SeqNo. of the entry of rcv_ooo received last */
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
+#if defined(MODULE_GNRC_SOCK_TCP) && defined(SOCK_HAS_ASYNC)
+    struct _transmission_control_block_queue *queue; /**< Listening queue of the TCB */
+    sock_tcp_cb_t async_cb;  /**< Asynchronous event callback */
+    void *async_cb_arg;      /**< Asynchronous event callback argument */
+    sock_async_flags_t async_flags; /**< Asynchronous events not reported yet */
+#ifdef SOCK_HAS_ASYNC_CTX
+    sock_async_ctx_t async_ctx; /**< Asynchronous event context */
+#endif
+#endif
     struct _transmission_control_block *next;   /**< Pointer next TCB */
 } gnrc_tcp_tcb_t;
 
@@ -86,12 +135,19 @@ typedef struct _transmission_control_block_queue {
     mutex_t lock;         /**< Mutex for access synchronization */
     gnrc_tcp_tcb_t *tcbs; /**< Pointer to TCB sequence */
     size_t tcbs_len;      /**< Number of TCBs behind member tcbs */
+#if defined(MODULE_GNRC_SOCK_TCP) && defined(SOCK_HAS_ASYNC)
+    sock_tcp_queue_cb_t async_cb; /**< Asynchronous event callback */
+    void *async_cb_arg;           /**< Asynchronous event callback argument */
+#ifdef SOCK_HAS_ASYNC_CTX
+    sock_async_ctx_t async_ctx;   /**< Asynchronous event context */
+#endif
+#endif
 } gnrc_tcp_tcb_queue_t;
 
 /**
  * @brief Static initializer for type gnrc_tcp_tcb_queue_t
  */
-#define GNRC_TCP_TCB_QUEUE_INIT   { MUTEX_INIT, NULL, 0 }
+#define GNRC_TCP_TCB_QUEUE_INIT   { .lock = MUTEX_INIT, .tcbs = NULL, .tcbs_len = 0 }
 
 #ifdef __cplusplus
 }
@@ -31,10 +31,26 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Callback signaling TX completion
+ *
+ * @param[in] arg   gnrc_tx_sync_t::arg
+ */
+typedef void (*gnrc_tx_sync_cb_t)(void *arg);
+
 /**
  * @brief   TX synchronization data */
 typedef struct {
     mutex_t signal;     /**< Mutex used for synchronization */
+    /**
+     * @brief   Called on completion instead of unlocking
+     *          gnrc_tx_sync_t::signal, if not NULL
+     *
+     * The callback runs in the thread releasing the packet while the packet
+     * buffer is locked, so it must not call any packet buffer function.
+     */
+    gnrc_tx_sync_cb_t cb;
+    void *arg;          /**< Argument for gnrc_tx_sync_t::cb */
 } gnrc_tx_sync_t;
 
 /**
@@ -97,6 +113,30 @@ static inline int gnrc_tx_sync_append(gnrc_pktsnip_t *pkt,
  */
 gnrc_pktsnip_t * gnrc_tx_sync_split(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Appends a newly allocated tx sync pktsnip to the end of the packet
+ *          that calls @p cb on completion
+ *
+ * @param[in]       pkt     Packet to append TX sync pktsnip to
+ * @param[out]      tx_sync TX sync structure to initialize and append. Needs
+ *                          to stay valid until @p cb was called.
+ * @param[in]       cb      Callback to call on completion
+ * @param[in]       arg     Argument for @p cb
+ *
+ * @retval  0       Success
+ * @retval  -ENOMEM Allocation failed
+ */
+static inline int gnrc_tx_sync_append_cb(gnrc_pktsnip_t *pkt,
+                                         gnrc_tx_sync_t *tx_sync,
+                                         gnrc_tx_sync_cb_t cb, void *arg)
+{
+    int res = gnrc_tx_sync_append(pkt, tx_sync);
+
+    tx_sync->cb = cb;
+    tx_sync->arg = arg;
+    return res;
+}
+
 /**
  * @brief   Signal TX completion via the given tx sync packet snip
  *
@@ -109,7 +149,12 @@ static inline void gnrc_tx_complete(gnrc_pktsnip_t *pkt)
 {
     assert(IS_USED(MODULE_GNRC_TX_SYNC) && (pkt->type == GNRC_NETTYPE_TX_SYNC));
     gnrc_tx_sync_t *sync = (gnrc_tx_sync_t*)pkt->data;
-    mutex_unlock(&sync->signal);
+    if (sync->cb != NULL) {
+        sync->cb(sync->arg);
+    }
+    else {
+        mutex_unlock(&sync->signal);
+    }
 }
 
 /**
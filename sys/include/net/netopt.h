@@ -813,6 +813,22 @@ typedef enum {
      * @brief   (array of byte arrays) Leave an link layer multicast group
      */
     NETOPT_L2_GROUP_LEAVE,
+    /**
+     * @brief   (@ref netopt_enable_t) device inserts the TCP, UDP and ICMPv6
+     *          checksums of outgoing IPv6 packets (read-only)
+     *
+     * When enabled, the network stack may send such packets without
+     * calculating the checksum.
+     */
+    NETOPT_TX_CSUM_OFFLOAD,
+    /**
+     * @brief   (@ref netopt_enable_t) device verifies the TCP, UDP and ICMPv6
+     *          checksums of incoming IPv6 packets (read-only)
+     *
+     * When enabled, the device drops packets with an invalid checksum, so the
+     * network stack does not need to verify the checksum of received packets.
+     */
+    NETOPT_RX_CSUM_VALID,
     /**
      * @brief   maximum number of options defined here.
      *
@@ -51,6 +51,7 @@ extern "C" {
 #define NETSTATS_LAYER2     (0x01)
 #define NETSTATS_IPV6       (0x02)
 #define NETSTATS_RPL        (0x03)
+#define NETSTATS_PKTQ_FQ    (0x04)
 #define NETSTATS_ALL        (0xFF)
 /** @} */
 
@@ -70,6 +71,20 @@ typedef struct {
     uint32_t rx_bytes;          /**< received bytes */
 } netstats_t;
 
+/**
+ * @brief       Statistics of a flow queue of a network interface
+ *
+ * @see         net_gnrc_netif_pktq_fq
+ */
+typedef struct {
+    uint32_t enqueued;          /**< packets put into the queue */
+    uint32_t dequeued;          /**< packets taken from the queue to be sent */
+    uint32_t dequeued_bytes;    /**< bytes taken from the queue to be sent */
+    uint32_t dropped;           /**< packets dropped since the queues were full */
+    uint16_t backlog;           /**< packets currently in the queue */
+    uint16_t backlog_max;       /**< maximum of netstats_fq_t::backlog */
+} netstats_fq_t;
+
 /**
  * @brief       Stats per peer struct
  */
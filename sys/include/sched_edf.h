@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_edf Earliest deadline first scheduling
+ * @ingroup     sys
+ * @brief       Deadline-aware scheduling class on top of the fixed priority
+ *              scheduler
+ *
+ * RIOT's scheduler always runs the highest priority runnable thread, and
+ * threads of the same priority in FIFO order. With this module, threads can
+ * additionally be given a deadline. Among the runnable threads of the same
+ * priority, threads with a deadline always run first, the one with the
+ * earliest deadline first. A thread getting runnable preempts a running thread
+ * of the same priority with a later (or no) deadline.
+ *
+ * Priorities still take precedence: a higher priority thread always preempts
+ * a thread with a deadline.
+ *
+ * Periodic threads use @ref thread_periodic_release(): it ends the current
+ * job and puts the thread to sleep until its next release. At release time,
+ * the deadline (the release after that) is attached from a timer callback
+ * before the thread is woken up, so it preempts a running thread of the same
+ * priority without a deadline right away. Other jobs are put into the
+ * deadline class with @ref thread_set_deadline(), e.g. by the ISR that wakes
+ * the thread up, and leave it with @ref thread_clear_deadline(). A thread
+ * whose deadline is cleared keeps its position in the runqueue.
+ *
+ * A ztimer tracks each armed deadline; if it passes before the job is done,
+ * the deadline is counted as missed. The thread stays in the deadline class
+ * (and is thus most urgent) until its deadline is cleared or renewed. Missed
+ * deadlines are reported per thread by @ref thread_missed_deadlines() and, if
+ * @ref schedstatistics is used, by `ps`.
+ *
+ * A typical periodic control loop looks like this:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * uint32_t last_release = ztimer_now(ZTIMER_USEC);
+ *
+ * while (1) {
+ *     thread_periodic_release(&last_release, PERIOD_US);
+ *     control_step();
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Earliest deadline first scheduling class
+ */
+
+#ifndef SCHED_EDF_H
+#define SCHED_EDF_H
+
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Set the deadline of a thread
+ *
+ * An already set deadline of @p pid is replaced without counting it as
+ * missed. Can be called from interrupt context, e.g. right before waking up
+ * @p pid. Must not be used for a thread waiting in
+ * @ref thread_periodic_release().
+ *
+ * @param[in] pid       Thread to set the deadline for
+ * @param[in] deadline  Deadline in microseconds from now
+ *
+ * @retval  0 on success
+ * @retval  -EINVAL if @p pid is not a valid thread
+ */
+int thread_set_deadline(kernel_pid_t pid, uint32_t deadline);
+
+/**
+ * @brief   Clear the deadline of a thread
+ *
+ * The thread is scheduled by its priority only again. It keeps its position
+ * in the runqueue, so a running thread keeps running.
+ *
+ * @param[in] pid       Thread to clear the deadline of
+ *
+ * @retval  0 on success
+ * @retval  -EINVAL if @p pid is not a valid thread
+ */
+int thread_clear_deadline(kernel_pid_t pid);
+
+/**
+ * @brief   End the current job of a periodic thread and sleep until the next
+ *          release
+ *
+ * The deadline of the calling thread is cleared and the thread sleeps until
+ * @p last_release + @p period. It then runs with the deadline
+ * @p last_release + 2 * @p period, i.e. each job has to be done before the
+ * next one is released. If the next release already passed, the function
+ * returns right away with the deadline of that job set.
+ *
+ * @param[in,out] last_release  Time of the last release in ztimer usec ticks,
+ *                              advanced by @p period
+ * @param[in] period            Period in microseconds
+ */
+void thread_periodic_release(uint32_t *last_release, uint32_t period);
+
+/**
+ * @brief   Get the number of deadlines a thread missed
+ *
+ * @param[in] pid       Thread to get the number of missed deadlines of
+ *
+ * @return  number of missed deadlines since boot
+ */
+unsigned thread_missed_deadlines(kernel_pid_t pid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_EDF_H */
+/** @} */
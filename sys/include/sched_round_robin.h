@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_round_robin Round robin time slicing
+ * @ingroup     sys
+ * @brief       Preempts threads in favour of runnable threads of the same
+ *              priority after a time slice
+ *
+ * RIOT's scheduler never preempts a running thread in favour of a thread of
+ * the same priority, unless the running thread yields or blocks. When this
+ * module is used, a running thread is moved to the end of the runqueue of its
+ * priority once it ran for @ref CONFIG_SCHED_RR_QUANTUM_US while other
+ * threads of the same priority are runnable.
+ *
+ * The time slice is only tracked (using a single ztimer) while the runqueue of
+ * the running thread holds more than one thread, so there is no periodic
+ * wake-up while the system is idle or has no competing threads. Threads of
+ * the idle priority are never sliced.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Round robin time slicing for threads of the same priority
+ */
+
+#ifndef SCHED_ROUND_ROBIN_H
+#define SCHED_ROUND_ROBIN_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_sched_round_robin_conf Round robin scheduling configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Time slice in microseconds
+ */
+#ifndef CONFIG_SCHED_RR_QUANTUM_US
+#define CONFIG_SCHED_RR_QUANTUM_US  (10000U)
+#endif
+/** @} */
+
+/**
+ * @brief   Enables or disables time slicing at runtime
+ *
+ * Time slicing is enabled on boot. While disabled, threads of the same
+ * priority are scheduled as without this module, e.g. to compare the
+ * context switch cost with and without time slicing in the same image.
+ *
+ * @param[in] enable    true to enable, false to disable time slicing
+ */
+void sched_round_robin_enable(bool enable);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_ROUND_ROBIN_H */
+/** @} */
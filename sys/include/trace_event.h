@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_trace_event Kernel event tracer
+ * @ingroup     sys
+ * @brief       Records scheduler, IPC and ISR events into a ring buffer
+ *
+ * When this module is used, the kernel records the following events together
+ * with a timestamp into a statically allocated ring buffer:
+ *
+ * | Event                              | `pid`               | `arg`          |
+ * |:---------------------------------- |:------------------- |:-------------- |
+ * | @ref TRACE_EVENT_SCHED_SWITCH      | next thread         | previous pid   |
+ * | @ref TRACE_EVENT_MSG_SEND          | target thread       | message type   |
+ * | @ref TRACE_EVENT_MSG_RECV          | sender              | message type   |
+ * | @ref TRACE_EVENT_MUTEX_BLOCK       | blocking thread     | mutex address  |
+ * | @ref TRACE_EVENT_MUTEX_UNBLOCK     | woken up thread     | mutex address  |
+ * | @ref TRACE_EVENT_THREAD_FLAGS_SET  | target thread       | flags set      |
+ * | @ref TRACE_EVENT_THREAD_FLAGS_WAIT | waiting thread      | awaited flags  |
+ * | @ref TRACE_EVENT_ISR_ENTER         | -                   | IRQ number     |
+ * | @ref TRACE_EVENT_ISR_EXIT          | -                   | IRQ number     |
+ * | @ref TRACE_EVENT_USER              | calling thread      | user value     |
+ *
+ * Events raised from interrupt context carry @ref TRACE_EVENT_FLAG_ISR. The
+ * thread an event got raised by is the one the last
+ * @ref TRACE_EVENT_SCHED_SWITCH switched to.
+ *
+ * The kernel reports its events through @ref sched_trace_callback(), which
+ * this module implements. As that is called from within the scheduler with
+ * interrupts disabled, the timestamp is the raw counter of the timer behind
+ * @ref ZTIMER_USEC (@ref CONFIG_ZTIMER_USEC_DEV), read with @ref timer_read()
+ * instead of going through ztimer. The dump states its frequency and width,
+ * so the decoder can convert it to microseconds.
+ *
+ * Recording starts during auto init, once the timer is initialized, and can
+ * be paused with @ref trace_event_stop(). If the buffer is full, the oldest
+ * events are overwritten.
+ *
+ * @ref trace_event_dump() prints the buffer as text lines prefixed with
+ * `trace_event:` (also available as shell command `trace_event dump`). The
+ * tool in `dist/tools/trace_event` converts such a dump to the Chrome trace
+ * event JSON format, which can be viewed with Perfetto (https://ui.perfetto.dev)
+ * or `chrome://tracing`:
+ *
+ *     make term | tee trace.log
+ *     dist/tools/trace_event/trace_event.py trace.log > trace.json
+ *
+ * @note    ISR entry and exit are recorded by CPUs that call
+ *          @ref trace_event_isr_enter() and @ref trace_event_isr_exit() in
+ *          their interrupt dispatcher. Currently this is done by `native`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Kernel event tracer API
+ */
+
+#ifndef TRACE_EVENT_H
+#define TRACE_EVENT_H
+
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "sched.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_trace_event_conf Kernel event tracer configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of events the trace buffer can hold
+ *
+ * @pre     Must be a power of two
+ */
+#ifndef CONFIG_TRACE_EVENT_BUFSIZE
+#define CONFIG_TRACE_EVENT_BUFSIZE  (256U)
+#endif
+/** @} */
+
+/**
+ * @brief   Version of the dump format printed by @ref trace_event_dump()
+ */
+#define TRACE_EVENT_VERSION         (2U)
+
+/**
+ * @brief   Flag set in @ref trace_event_t::flags for events recorded in
+ *          interrupt context
+ */
+#define TRACE_EVENT_FLAG_ISR        (0x01U)
+
+/**
+ * @brief   Event types
+ */
+typedef enum {
+    TRACE_EVENT_SCHED_SWITCH = SCHED_TRACE_SWITCH,  /**< context switch */
+    TRACE_EVENT_MSG_SEND = SCHED_TRACE_MSG_SEND,    /**< message sent or replied */
+    TRACE_EVENT_MSG_RECV = SCHED_TRACE_MSG_RECV,    /**< message received */
+    /** thread blocked on a mutex */
+    TRACE_EVENT_MUTEX_BLOCK = SCHED_TRACE_MUTEX_BLOCK,
+    /** thread got the mutex handed over */
+    TRACE_EVENT_MUTEX_UNBLOCK = SCHED_TRACE_MUTEX_UNBLOCK,
+    /** thread flags set */
+    TRACE_EVENT_THREAD_FLAGS_SET = SCHED_TRACE_THREAD_FLAGS_SET,
+    /** thread blocked on thread flags */
+    TRACE_EVENT_THREAD_FLAGS_WAIT = SCHED_TRACE_THREAD_FLAGS_WAIT,
+    TRACE_EVENT_ISR_ENTER,          /**< interrupt service routine entered */
+    TRACE_EVENT_ISR_EXIT,           /**< interrupt service routine left */
+    TRACE_EVENT_USER,               /**< recorded by @ref trace_event_user() */
+} trace_event_type_t;
+
+/**
+ * @brief   A recorded event, as stored in the trace buffer
+ */
+typedef struct {
+    uint32_t time;                  /**< timestamp in timer ticks */
+    uint8_t type;                   /**< event type (@ref trace_event_type_t) */
+    uint8_t flags;                  /**< TRACE_EVENT_FLAG_* */
+    int16_t pid;                    /**< thread the event refers to */
+    uint32_t arg;                   /**< event specific argument */
+} trace_event_t;
+
+#if IS_USED(MODULE_TRACE_EVENT) || defined(DOXYGEN)
+/**
+ * @brief   Record an event
+ *
+ * Safe to call from any context. Does nothing while recording is stopped.
+ *
+ * @param[in]   type    event type
+ * @param[in]   pid     thread the event refers to
+ * @param[in]   arg     event specific argument
+ */
+void trace_event_record(trace_event_type_t type, kernel_pid_t pid,
+                        uint32_t arg);
+
+/**
+ * @brief   Start (or resume) recording events
+ *
+ * Called during auto init, an application only needs to call this after
+ * @ref trace_event_stop().
+ */
+void trace_event_start(void);
+
+/**
+ * @brief   Stop recording events, e.g. to dump the buffer
+ */
+void trace_event_stop(void);
+
+/**
+ * @brief   Empty the trace buffer
+ */
+void trace_event_reset(void);
+
+/**
+ * @brief   Print the threads and the recorded events, oldest first
+ *
+ * The output is meant to be parsed by `dist/tools/trace_event/trace_event.py`.
+ * Recording is paused while dumping.
+ */
+void trace_event_dump(void);
+#else
+static inline void trace_event_record(trace_event_type_t type,
+                                      kernel_pid_t pid, uint32_t arg)
+{
+    (void)type;
+    (void)pid;
+    (void)arg;
+}
+#endif
+
+/**
+ * @brief   Record an application defined event
+ *
+ * @param[in]   val     value to record
+ */
+static inline void trace_event_user(uint32_t val)
+{
+    trace_event_record(TRACE_EVENT_USER, thread_getpid(), val);
+}
+
+/**
+ * @brief   Record the entry into an interrupt service routine
+ *
+ * @param[in]   irq     number of the interrupt
+ */
+static inline void trace_event_isr_enter(unsigned irq)
+{
+    trace_event_record(TRACE_EVENT_ISR_ENTER, KERNEL_PID_ISR, irq);
+}
+
+/**
+ * @brief   Record leaving an interrupt service routine
+ *
+ * @param[in]   irq     number of the interrupt
+ */
+static inline void trace_event_isr_exit(unsigned irq)
+{
+    trace_event_record(TRACE_EVENT_ISR_EXIT, KERNEL_PID_ISR, irq);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_EVENT_H */
+/** @} */
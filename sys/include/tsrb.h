@@ -165,6 +165,59 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @brief       Get the contiguous free space at the write position
+ *
+ * Together with @ref tsrb_commit() this allows e.g. a DMA transfer or a
+ * driver to write directly into the ringbuffer memory, without an
+ * intermediate buffer. As the free space may wrap around the end of the
+ * buffer, up to two calls may be needed to fill all of it.
+ *
+ * @note        Only the (single) writer of @p rb may use this function.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst Start of the contiguous free region
+ * @return      size of the region starting at @p dst in bytes, 0 if full
+ */
+size_t tsrb_get_write_span(tsrb_t *rb, uint8_t **dst);
+
+/**
+ * @brief       Mark bytes written into a span as available for reading
+ *
+ * @pre         @p n is not larger than the length returned by the last call
+ *              to @ref tsrb_get_write_span()
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   number of bytes written into the span
+ */
+void tsrb_commit(tsrb_t *rb, size_t n);
+
+/**
+ * @brief       Get the contiguous data available at the read position
+ *
+ * The data stays in the ringbuffer until it is released with
+ * @ref tsrb_consume(). As the data may wrap around the end of the buffer,
+ * up to two calls may be needed to drain all of it.
+ *
+ * @note        Only the (single) reader of @p rb may use this function.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  src Start of the contiguous data
+ * @return      number of bytes available at @p src, 0 if empty
+ */
+size_t tsrb_peek_read_span(tsrb_t *rb, const uint8_t **src);
+
+/**
+ * @brief       Release bytes read from a span
+ *
+ * @pre         @p n is not larger than the length returned by the last call
+ *              to @ref tsrb_peek_read_span()
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   number of bytes to release
+ */
+void tsrb_consume(tsrb_t *rb, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -135,10 +135,17 @@
  * made a constant operation, at the price of another pointer per timer object
  * (for "previous" element).
  *
- * If deemed necessary, the linked list can be exchanged our augmented with
- * another data structure providing better algorithmic guarantees. It remains
- * to be shown whether the increased complexity would lead to better
- * performance for any reasonable amount of active timers.
+ * For applications with many concurrently active timers, the `ztimer_heap`
+ * module replaces the list with a binary min-heap, built from two additional
+ * pointers per timer object (and a counter per clock):
+ *
+ * - each timer stores its absolute target time (B + T), B is updated as before
+ * - O(log n) insertion / removal of timer objects
+ * - O(log n) removal of the first timer when it triggers
+ * - timers with the same target time may trigger in any order
+ *
+ * `tests/bench_timers` can be configured to compare both implementations
+ * (see its README).
  *
  *
  * ## Clock extension
@@ -270,8 +277,14 @@ typedef struct ztimer_clock ztimer_clock_t;
  * @brief   Minimum information for each timer
  */
 struct ztimer_base {
-    ztimer_base_t *next;        /**< next timer in list */
-    uint32_t offset;            /**< offset from last timer in list */
+    ztimer_base_t *next;        /**< next timer in list
+                                     (left child with `ztimer_heap`) */
+    uint32_t offset;            /**< offset from last timer in list
+                                     (absolute target with `ztimer_heap`) */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *right;       /**< right child in the timer heap */
+    ztimer_base_t *parent;      /**< parent in the timer heap */
+#endif
 };
 
 #if MODULE_ZTIMER_NOW64
@@ -320,6 +333,21 @@ typedef struct {
     void (*cancel)(ztimer_clock_t *clock);
 } ztimer_ops_t;
 
+#if MODULE_ZTIMER_STATS || DOXYGEN
+/**
+ * @brief   Wakeup statistics of a clock, provided by the `ztimer_stats` module
+ */
+typedef struct {
+    uint32_t wakeups;               /**< number of interrupts that triggered
+                                         at least one timer                 */
+    uint32_t avoided;               /**< number of timers triggered without
+                                         an interrupt of their own          */
+    uint32_t coalesced;             /**< number of timers moved to another
+                                         timer's target by
+                                         @ref ztimer_set_with_slack()       */
+} ztimer_stats_t;
+#endif
+
 /**
  * @brief   ztimer device structure
  */
@@ -327,6 +355,9 @@ struct ztimer_clock {
     ztimer_base_t list;             /**< list of active timers              */
     const ztimer_ops_t *ops;        /**< pointer to methods structure       */
     ztimer_base_t *last;            /**< last timer in queue, for _is_set() */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    unsigned heap_size;             /**< number of timers in the heap       */
+#endif
     uint16_t adjust_set;            /**< will be subtracted on every set()  */
     uint16_t adjust_sleep;          /**< will be subtracted on every sleep(),
                                          in addition to adjust_set          */
@@ -339,6 +370,9 @@ struct ztimer_clock {
 #if MODULE_PM_LAYERED || DOXYGEN
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run */
 #endif
+#if MODULE_ZTIMER_STATS || DOXYGEN
+    ztimer_stats_t stats;           /**< wakeup statistics                  */
+#endif
 };
 
 /**
@@ -346,6 +380,28 @@ struct ztimer_clock {
  */
 void ztimer_handler(ztimer_clock_t *clock);
 
+#if MODULE_ZTIMER_STATS || DOXYGEN
+/**
+ * @brief   Get the wakeup statistics of a clock
+ *
+ * The statistics are updated by @ref ztimer_handler(). Comparing
+ * ztimer_stats_t::avoided with ztimer_stats_t::wakeups tells how many
+ * interrupts were saved by timers sharing a target, e.g. through
+ * @ref ztimer_set_with_slack().
+ *
+ * @param[in]   clock       ztimer clock to get the statistics of
+ * @param[out]  stats       copy of the statistics
+ */
+void ztimer_stats_get(const ztimer_clock_t *clock, ztimer_stats_t *stats);
+
+/**
+ * @brief   Reset the wakeup statistics of a clock
+ *
+ * @param[in]   clock       ztimer clock to reset the statistics of
+ */
+void ztimer_stats_reset(ztimer_clock_t *clock);
+#endif
+
 /* User API */
 /**
  * @brief   Set a timer on a clock
@@ -362,6 +418,30 @@ void ztimer_handler(ztimer_clock_t *clock);
  */
 void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set a timer on a clock, allowing it to trigger late
+ *
+ * Like @ref ztimer_set(), but if another timer on @p clock is set to trigger
+ * at most @p slack ticks after @p val, @p timer is set to trigger together
+ * with that timer. This way, timers that don't need to be precise (e.g.,
+ * periodic housekeeping) can share a single interrupt with other timers
+ * instead of waking up the CPU on their own.
+ *
+ * Only timers that are already set are considered, so a timer set later on
+ * using @ref ztimer_set() doesn't get merged.
+ *
+ * @note    With the `ztimer_heap` module, the search for a matching timer
+ *          visits all timers set to trigger before @p val.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         timer target (relative ticks from now)
+ * @param[in]   slack       maximum number of ticks @p timer may trigger
+ *                          after @p val
+ */
+void ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                           uint32_t val, uint32_t slack);
+
 /**
  * @brief   Check if a timer is currently active
  *
@@ -13,16 +13,78 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+
+#include "architecture.h"
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* folds a sum of 16-bit words down to 16 bit with end-around carry */
+static inline uint16_t _fold(uint32_t sum)
+{
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return sum;
+}
+
+/* Sums buf as 16-bit words in host byte order. The ones-complement sum is
+ * independent of the byte order (RFC 1071, section 2 (B)), so the result
+ * only needs to be swapped once at the end instead of for every word.
+ * buf needs to be 16-bit aligned, len needs to be even. */
+static uint16_t _sum_words(const uint8_t *buf, size_t len)
+{
+#if ARCHITECTURE_WORD_BITS >= 32
+    /* carries of 32-bit additions are collected in the upper half and are
+     * only folded in at the end; len is at most UINT16_MAX, so this can not
+     * overflow */
+    uint64_t sum = 0;
+
+    if (((uintptr_t)buf & 2) && (len >= 2)) {
+        sum += *((const uint16_t *)buf);
+        buf += 2;
+        len -= 2;
+    }
+    const uint32_t *words = (const uint32_t *)buf;
+
+    for (; len >= 4 * sizeof(uint32_t); len -= 4 * sizeof(uint32_t)) {
+        sum += words[0];
+        sum += words[1];
+        sum += words[2];
+        sum += words[3];
+        words += 4;
+    }
+    for (; len >= sizeof(uint32_t); len -= sizeof(uint32_t)) {
+        sum += *words++;
+    }
+    buf = (const uint8_t *)words;
+    if (len >= 2) {
+        sum += *((const uint16_t *)buf);
+    }
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    return _fold((uint32_t)sum);
+#else
+    const uint16_t *words = (const uint16_t *)buf;
+    uint32_t sum = 0;
+
+    for (; len >= 2; len -= 2) {
+        sum += *words++;
+    }
+    return _fold(sum);
+#endif
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
+    uint16_t words_sum;
+    bool odd_addr;
 
     DEBUG("inet_sum: sum = 0x%04" PRIx16 ", len = %" PRIu16, sum, len);
 
@@ -42,22 +104,30 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
+    if (len & 1) {            /* add last byte as top half of 16-byte word */
+        len--;
+        csum += (uint16_t)(buf[len] << 8);
     }
 
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
-
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
+    /* On an odd address, the aligned words pair every byte with the wrong
+     * neighbor. Their sum is the byte-swapped sum of the correctly paired
+     * words (RFC 1071, section 2 (B)), so it is swapped back below. The first
+     * and the last byte are left over as top and bottom half of a word. */
+    odd_addr = (uintptr_t)buf & 1;
+    if (odd_addr && (len > 0)) {
+        csum += (uint16_t)(*buf << 8) + buf[len - 1];
+        buf++;
+        len -= 2;
     }
 
+    words_sum = _sum_words(buf, len);
+    /* the words were summed in host byte order */
+    csum += odd_addr ? byteorder_swaps(ntohs(words_sum)) : ntohs(words_sum);
+
+    csum = _fold(csum);
+
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
     return csum;
@@ -129,6 +129,8 @@ static const char *_netopt_strmap[] = {
     [NETOPT_BATMON]                = "NETOPT_BATMON",
     [NETOPT_L2_GROUP]              = "NETOPT_L2_GROUP",
     [NETOPT_L2_GROUP_LEAVE]        = "NETOPT_L2_GROUP_LEAVE",
+    [NETOPT_TX_CSUM_OFFLOAD]       = "NETOPT_TX_CSUM_OFFLOAD",
+    [NETOPT_RX_CSUM_VALID]         = "NETOPT_RX_CSUM_VALID",
     [NETOPT_NUMOF]                 = "NETOPT_NUMOF",
 };
 
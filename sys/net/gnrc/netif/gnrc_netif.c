@@ -32,6 +32,10 @@
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq.h"
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/sixlowpan/internal.h"
+#endif /* IS_USED(MODULE_GNRC_NETIF_RX_BATCH) */
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
 #include "net/gnrc/sixlowpan/frag/sfr.h"
 #endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
@@ -87,6 +91,9 @@ int gnrc_netif_create(gnrc_netif_t *netif, char *stack, int stacksize,
 #ifdef MODULE_NETSTATS_NEIGHBOR
     netstats_nb_init(&netif->netif);
 #endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+    netif->rx_batch_len = 0;
+#endif
 
     /* prepare thread context */
     ctx.netif = netif;
@@ -199,6 +206,13 @@ int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
                     *((netstats_t **)opt->data) = &netif->stats;
                     res = sizeof(&netif->stats);
                     break;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+                case NETSTATS_PKTQ_FQ:
+                    assert(opt->data_len == sizeof(netstats_fq_t *));
+                    *((netstats_fq_t **)opt->data) = netif->send_queue.flow_stats;
+                    res = sizeof(netstats_fq_t *);
+                    break;
 #endif
                 default:
                     /* take from device */
@@ -1258,6 +1272,26 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif)
     }
 }
 
+static bool _dev_enabled(netdev_t *dev, netopt_t opt)
+{
+    netopt_enable_t enable = NETOPT_DISABLE;
+    int res = dev->driver->get(dev, opt, &enable, sizeof(enable));
+
+    return (res == sizeof(enable)) && (enable == NETOPT_ENABLE);
+}
+
+static void _init_csum_offload(gnrc_netif_t *netif)
+{
+    netif->flags &= ~(GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD |
+                      GNRC_NETIF_FLAGS_RX_CSUM_VALID);
+    if (_dev_enabled(netif->dev, NETOPT_TX_CSUM_OFFLOAD)) {
+        netif->flags |= GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD;
+    }
+    if (_dev_enabled(netif->dev, NETOPT_RX_CSUM_VALID)) {
+        netif->flags |= GNRC_NETIF_FLAGS_RX_CSUM_VALID;
+    }
+}
+
 static void _init_from_device(gnrc_netif_t *netif)
 {
     int res;
@@ -1270,6 +1304,7 @@ static void _init_from_device(gnrc_netif_t *netif)
     netif->device_type = (uint8_t)tmp;
     gnrc_netif_ipv6_init_mtu(netif);
     _update_l2addr_from_dev(netif);
+    _init_csum_offload(netif);
 }
 
 static void _check_netdev_capabilities(netdev_t *dev)
@@ -1503,6 +1538,8 @@ static inline event_queue_t *_get_evq(gnrc_netif_t *netif)
  *
  * @return >0 if msg contains a new message
  */
+static void _rx_batch_flush(gnrc_netif_t *netif);
+
 static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
 {
     if (IS_USED(MODULE_GNRC_NETIF_EVENTS)) {
@@ -1527,6 +1564,8 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
             if (msg_waiting > 0) {
                 return;
             }
+            /* nothing to do anymore, so pass up what was received */
+            _rx_batch_flush(netif);
             DEBUG("gnrc_netif: waiting for events\n");
             /* Block the thread until something interesting happens */
             thread_flags_wait_any(THREAD_FLAG_MSG_WAITING | THREAD_FLAG_EVENT);
@@ -1534,6 +1573,10 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
     }
     else {
         /* Only messages used for event handling */
+        if (msg_avail() <= 0) {
+            /* nothing to do anymore, so pass up what was received */
+            _rx_batch_flush(netif);
+        }
         DEBUG("gnrc_netif: waiting for incoming messages\n");
         msg_receive(msg);
     }
@@ -1597,10 +1640,12 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     gnrc_pktsnip_t *tx_sync = IS_USED(MODULE_GNRC_TX_SYNC)
                             ? gnrc_tx_sync_split(pkt) : NULL;
     res = netif->ops->send(netif, pkt);
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     if (tx_sync != NULL) {
-        uint32_t err = (res < 0) ? -res : GNRC_NETERR_SUCCESS;
-        gnrc_pktbuf_release_error(tx_sync, err);
+        /* drop the hold of the TX sync snip, it was split off before sending */
+        gnrc_pktbuf_release(tx_sync);
     }
+#endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 
     /* no frame was transmitted */
     if (res < 0) {
@@ -1626,6 +1671,12 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
          * could run into the risk of overriding the received packet on send
          * Rather, queue the packet within the netif now and try to send them
          * again after the device completed its busy state. */
+        if (tx_sync != NULL) {
+            /* the transmission is not done yet, so keep the TX sync snip with
+             * the packet */
+            pkt = gnrc_pkt_append(pkt, tx_sync);
+            tx_sync = NULL;
+        }
         if (push_back) {
             put_res = gnrc_netif_pktq_push_back(netif, pkt);
         }
@@ -1650,6 +1701,10 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
         gnrc_pktbuf_release(pkt);
     }
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+    if (tx_sync != NULL) {
+        uint32_t err = (res < 0) ? -res : GNRC_NETERR_SUCCESS;
+        gnrc_pktbuf_release_error(tx_sync, err);
+    }
 }
 
 static void *_gnrc_netif_thread(void *args)
@@ -1792,6 +1847,108 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
     }
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+/* thread that handles GNRC_NETAPI_MSG_TYPE_RCV_BATCH for type, if it is the
+ * only one registered for it */
+static kernel_pid_t _rx_batch_target(gnrc_nettype_t type)
+{
+    kernel_pid_t pid;
+    gnrc_netreg_entry_t *entry;
+
+    switch (type) {
+#if IS_USED(MODULE_GNRC_IPV6)
+        case GNRC_NETTYPE_IPV6:
+            pid = gnrc_ipv6_pid;
+            break;
+#endif
+#if IS_USED(MODULE_GNRC_SIXLOWPAN)
+        case GNRC_NETTYPE_SIXLOWPAN:
+            pid = gnrc_sixlowpan_get_pid();
+            break;
+#endif
+        default:
+            return KERNEL_PID_UNDEF;
+    }
+    if (gnrc_netreg_num(type, GNRC_NETREG_DEMUX_CTX_ALL) != 1) {
+        return KERNEL_PID_UNDEF;
+    }
+    entry = gnrc_netreg_lookup(type, GNRC_NETREG_DEMUX_CTX_ALL);
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    if (entry->type != GNRC_NETREG_TYPE_DEFAULT) {
+        return KERNEL_PID_UNDEF;
+    }
+#endif
+    return (entry->target.pid == pid) ? pid : KERNEL_PID_UNDEF;
+}
+
+/* passes up numof packets of the same type with one message, returns false if
+ * they need to be passed up one by one */
+static bool _pass_on_batch(gnrc_pktsnip_t **pkts, unsigned numof)
+{
+    kernel_pid_t pid = _rx_batch_target(pkts[0]->type);
+    gnrc_pktsnip_t *batch;
+
+    if (pid == KERNEL_PID_UNDEF) {
+        return false;
+    }
+    batch = gnrc_pktbuf_add(NULL, pkts, numof * sizeof(*pkts),
+                            GNRC_NETTYPE_UNDEF);
+    if (batch == NULL) {
+        return false;
+    }
+    if (_gnrc_netapi_send_recv(pid, batch,
+                               GNRC_NETAPI_MSG_TYPE_RCV_BATCH) < 1) {
+        DEBUG("gnrc_netif: unable to forward batch of %u packets\n", numof);
+        gnrc_pktbuf_release(batch);
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release_error(pkts[i], EIO);
+        }
+    }
+    return true;
+}
+
+static void _rx_batch_flush(gnrc_netif_t *netif)
+{
+    unsigned i = 0;
+
+    while (i < netif->rx_batch_len) {
+        gnrc_pktsnip_t **pkts = &netif->rx_batch[i];
+        unsigned numof = 1;
+
+        while (((i + numof) < netif->rx_batch_len) &&
+               (pkts[numof]->type == pkts[0]->type)) {
+            numof++;
+        }
+        if ((numof == 1) || !_pass_on_batch(pkts, numof)) {
+            for (unsigned j = 0; j < numof; j++) {
+                _pass_on_packet(pkts[j]);
+            }
+        }
+        i += numof;
+    }
+    netif->rx_batch_len = 0;
+}
+
+static void _rx_batch_add(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    netif->rx_batch[netif->rx_batch_len++] = pkt;
+    if (netif->rx_batch_len == CONFIG_GNRC_NETIF_RX_BATCH_SIZE) {
+        _rx_batch_flush(netif);
+    }
+}
+#else
+static inline void _rx_batch_flush(gnrc_netif_t *netif)
+{
+    (void)netif;
+}
+
+static inline void _rx_batch_add(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    (void)netif;
+    _pass_on_packet(pkt);
+}
+#endif
+
 static void _event_cb(netdev_t *dev, netdev_event_t event)
 {
     gnrc_netif_t *netif = (gnrc_netif_t *) dev->context;
@@ -1821,7 +1978,7 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 _send_queued_pkt(netif);
                 if (pkt) {
                     _process_receive_stats(netif, pkt);
-                    _pass_on_packet(pkt);
+                    _rx_batch_add(netif, pkt);
                 }
                 break;
 #if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
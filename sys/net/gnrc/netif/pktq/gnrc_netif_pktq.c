@@ -14,11 +14,15 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/pktqueue.h"
 #include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/pktq.h"
+#include "net/ipv6/hdr.h"
 
 static gnrc_pktqueue_t _pool[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
 
@@ -44,11 +48,176 @@ unsigned gnrc_netif_pktq_usage(void)
     return res;
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+/* FNV-1a */
+static uint32_t _hash(uint32_t hash, const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * 16777619U;
+    }
+    return hash;
+}
+
+unsigned gnrc_netif_pktq_fq_flow(const gnrc_pktsnip_t *pkt)
+{
+    uint32_t hash = 2166136261U;
+
+    if ((pkt != NULL) && (pkt->type == GNRC_NETTYPE_NETIF)) {
+        const gnrc_netif_hdr_t *hdr = pkt->data;
+
+        hash = _hash(hash, gnrc_netif_hdr_get_dst_addr(hdr),
+                     hdr->dst_l2addr_len);
+        pkt = pkt->next;
+    }
+#ifdef MODULE_GNRC_NETTYPE_IPV6
+    if ((pkt != NULL) && (pkt->type == GNRC_NETTYPE_IPV6) &&
+        (pkt->size >= sizeof(ipv6_hdr_t))) {
+        const ipv6_hdr_t *ipv6 = pkt->data;
+        const void *ports = NULL;
+
+        /* source and destination address are adjacent in the header */
+        hash = _hash(hash, &ipv6->src, 2 * sizeof(ipv6_addr_t));
+        hash = _hash(hash, &ipv6->nh, sizeof(ipv6->nh));
+        /* the header is only marked, but not split off, for forwarded
+         * packets */
+        if (pkt->size >= (sizeof(ipv6_hdr_t) + 4)) {
+            ports = ipv6 + 1;
+        }
+        else if ((pkt->size == sizeof(ipv6_hdr_t)) && (pkt->next != NULL) &&
+                 (pkt->next->size >= 4)) {
+            ports = pkt->next->data;
+        }
+        if (ports != NULL) {
+            hash = _hash(hash, ports, 4);
+        }
+    }
+#endif
+    /* the low bits of FNV-1a only depend on the low bits of the input, so
+     * fold the upper bits in for small flow counts */
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return hash % CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS;
+}
+
+/* takes the last packet of the longest flow queue, if it is longer than the
+ * queue of flow idx */
+static gnrc_pktqueue_t *_drop_from_longest(gnrc_netif_pktq_t *q, unsigned idx)
+{
+    gnrc_pktqueue_t *entry, *prev = NULL;
+    unsigned longest = idx;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS; i++) {
+        if (q->flow_stats[i].backlog > q->flow_stats[longest].backlog) {
+            longest = i;
+        }
+    }
+    if (longest == idx) {
+        return NULL;
+    }
+    entry = q->flows[longest].queue;
+    while (entry->next != NULL) {
+        prev = entry;
+        entry = entry->next;
+    }
+    if (prev == NULL) {
+        q->flows[longest].queue = NULL;
+    }
+    else {
+        prev->next = NULL;
+    }
+    q->flow_stats[longest].backlog--;
+    q->flow_stats[longest].dropped++;
+    gnrc_pktbuf_release_error(entry->pkt, ENOMEM);
+    entry->pkt = NULL;
+    return entry;
+}
+
+static int _fq_add(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool head)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    unsigned idx = gnrc_netif_pktq_fq_flow(pkt);
+    gnrc_netif_pktq_flow_t *flow = &q->flows[idx];
+    netstats_fq_t *stats = &q->flow_stats[idx];
+    gnrc_pktqueue_t *entry = _get_free_entry();
+
+    if ((entry == NULL) &&
+        ((entry = _drop_from_longest(q, idx)) == NULL)) {
+        stats->dropped++;
+        return -1;
+    }
+    entry->pkt = pkt;
+    entry->next = NULL;
+    if (head) {
+        size_t len = gnrc_pkt_len(pkt);
+
+        /* the packet was just taken from this flow, so give back its share
+         * and serve the flow next */
+        LL_PREPEND(flow->queue, entry);
+        flow->deficit += len;
+        q->cur = idx;
+        stats->dequeued--;
+        stats->dequeued_bytes -= len;
+    }
+    else {
+        gnrc_pktqueue_add(&flow->queue, entry);
+        stats->enqueued++;
+    }
+    if (++stats->backlog > stats->backlog_max) {
+        stats->backlog_max = stats->backlog;
+    }
+    return 0;
+}
+
+gnrc_pktsnip_t *gnrc_netif_pktq_fq_get(gnrc_netif_t *netif)
+{
+    assert(netif != NULL);
+
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+
+    if (gnrc_netif_pktq_empty(netif)) {
+        return NULL;
+    }
+    while (1) {
+        gnrc_netif_pktq_flow_t *flow = &q->flows[q->cur];
+
+        if (flow->queue != NULL) {
+            gnrc_pktsnip_t *pkt = flow->queue->pkt;
+            size_t len = gnrc_pkt_len(pkt);
+
+            if ((int32_t)len <= flow->deficit) {
+                netstats_fq_t *stats = &q->flow_stats[q->cur];
+                gnrc_pktqueue_t *entry = gnrc_pktqueue_remove_head(&flow->queue);
+
+                entry->pkt = NULL;
+                flow->deficit -= len;
+                if (flow->queue == NULL) {
+                    /* idle flows do not save up for later */
+                    flow->deficit = 0;
+                }
+                stats->backlog--;
+                stats->dequeued++;
+                stats->dequeued_bytes += len;
+                return pkt;
+            }
+        }
+        q->cur = (q->cur + 1) % CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS;
+        if (q->flows[q->cur].queue != NULL) {
+            q->flows[q->cur].deficit += CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM;
+        }
+    }
+}
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) */
+
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     assert(netif != NULL);
     assert(pkt != NULL);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    return _fq_add(netif, pkt, false);
+#else
     gnrc_pktqueue_t *entry = _get_free_entry();
 
     if (entry == NULL) {
@@ -57,6 +226,7 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     entry->pkt = pkt;
     gnrc_pktqueue_add(&netif->send_queue.queue, entry);
     return 0;
+#endif
 }
 
 void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif)
@@ -85,6 +255,9 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     assert(netif != NULL);
     assert(pkt != NULL);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    return _fq_add(netif, pkt, true);
+#else
     gnrc_pktqueue_t *entry = _get_free_entry();
 
     if (entry == NULL) {
@@ -93,6 +266,7 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     entry->pkt = pkt;
     LL_PREPEND(netif->send_queue.queue, entry);
     return 0;
+#endif
 }
 
 /** @} */
@@ -30,13 +30,21 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+/* The registry as lookup table by gnrc_nettype_t and hash of demux_ctx.
+ * All entries with the same demux_ctx are in the same bucket, so looking up
+ * the next entry for a context only needs to follow gnrc_netreg_entry_t::next */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][CONFIG_GNRC_NETREG_BUCKETS];
+
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+    return &netreg[type][demux_ctx % CONFIG_GNRC_NETREG_BUCKETS];
+}
 
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
@@ -61,7 +69,7 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*_bucket(type, entry->demux_ctx), entry);
 
     return 0;
 }
@@ -72,7 +80,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_bucket(type, entry->demux_ctx), entry);
 }
 
 /**
@@ -94,7 +102,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_bucket(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
@@ -24,6 +24,7 @@
 #include "net/ipv6/hdr.h"
 #include "net/gnrc.h"
 #include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/internal.h"
 #include "net/protnum.h"
 #include "od.h"
 #include "utlist.h"
@@ -53,6 +54,25 @@ static inline uint16_t _calc_csum(gnrc_pktsnip_t *hdr,
     return ~csum;
 }
 
+/* checks if the receiving device already verified the checksum: the device
+ * only checks single frames with the ICMPv6 header directly following the
+ * IPv6 header */
+static bool _csum_valid(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                        gnrc_pktsnip_t *ipv6)
+{
+    gnrc_pktsnip_t *netif_hdr;
+
+    /* netif is NULL for packets looped back by the node itself */
+    if ((netif == NULL) || !gnrc_netif_rx_csum_valid(netif) ||
+        (((ipv6_hdr_t *)ipv6->data)->nh != PROTNUM_ICMPV6)) {
+        return false;
+    }
+    netif_hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    return (netif_hdr != NULL) &&
+           !(((gnrc_netif_hdr_t *)netif_hdr->data)->flags &
+             GNRC_NETIF_HDR_FLAGS_REASSEMBLED);
+}
+
 void gnrc_icmpv6_demux(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     gnrc_pktsnip_t *icmpv6, *ipv6;
@@ -78,7 +98,7 @@ void gnrc_icmpv6_demux(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 
     hdr = (icmpv6_hdr_t *)icmpv6->data;
 
-    if (_calc_csum(icmpv6, ipv6, pkt)) {
+    if (!_csum_valid(netif, pkt, ipv6) && _calc_csum(icmpv6, ipv6, pkt)) {
         DEBUG("icmpv6: wrong checksum.\n");
         gnrc_pktbuf_release(pkt);
         return;
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "net/gnrc/ipv6/dst_cache.h"
+
+static gnrc_ipv6_dst_cache_t _cache[CONFIG_GNRC_IPV6_DST_CACHE_SIZE];
+static gnrc_ipv6_dst_cache_stats_t _stats;
+/* entry to replace if all entries are in use */
+static unsigned _next;
+/* starts at 1, so the zeroed entries are invalid */
+static volatile uint32_t _version = 1;
+
+static inline bool _valid(const gnrc_ipv6_dst_cache_t *entry, uint32_t version)
+{
+    return entry->version == version;
+}
+
+uint32_t gnrc_ipv6_dst_cache_version(void)
+{
+    return atomic_load_u32(&_version);
+}
+
+gnrc_ipv6_dst_cache_t *gnrc_ipv6_dst_cache_get(const ipv6_addr_t *dst,
+                                               unsigned iface)
+{
+    uint32_t version = atomic_load_u32(&_version);
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_DST_CACHE_SIZE; i++) {
+        gnrc_ipv6_dst_cache_t *entry = &_cache[i];
+
+        if (_valid(entry, version) && (entry->iface == iface) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+            _stats.hits++;
+            return entry;
+        }
+    }
+    _stats.misses++;
+    return NULL;
+}
+
+gnrc_ipv6_dst_cache_t *gnrc_ipv6_dst_cache_add(const ipv6_addr_t *dst,
+                                               unsigned iface,
+                                               const gnrc_ipv6_nib_nc_t *nce,
+                                               uint32_t version)
+{
+    gnrc_ipv6_dst_cache_t *res = NULL;
+    uint32_t cur = atomic_load_u32(&_version);
+
+    switch (gnrc_ipv6_nib_nc_get_nud_state(nce)) {
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE:
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED:
+            break;
+        default:
+            /* leave neighbor unreachability detection to the NIB */
+            return NULL;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_DST_CACHE_SIZE; i++) {
+        gnrc_ipv6_dst_cache_t *entry = &_cache[i];
+
+        if (!_valid(entry, cur)) {
+            if (res == NULL) {
+                res = entry;
+            }
+        }
+        else if ((entry->iface == iface) &&
+                 ipv6_addr_equal(&entry->dst, dst)) {
+            res = entry;
+            break;
+        }
+    }
+    if (res == NULL) {
+        res = &_cache[_next];
+        _next = (_next + 1) % CONFIG_GNRC_IPV6_DST_CACHE_SIZE;
+    }
+    memcpy(&res->dst, dst, sizeof(res->dst));
+    ipv6_addr_set_unspecified(&res->src);
+    memcpy(&res->nce, nce, sizeof(res->nce));
+    res->iface = iface;
+    /* if the NIB changed since the lookup, the entry is invalid already */
+    res->version = version;
+    return res;
+}
+
+void gnrc_ipv6_dst_cache_invalidate(void)
+{
+    atomic_fetch_add_u32(&_version, 1);
+}
+
+void gnrc_ipv6_dst_cache_stats_get(gnrc_ipv6_dst_cache_stats_t *stats)
+{
+    *stats = _stats;
+}
+
+/** @} */
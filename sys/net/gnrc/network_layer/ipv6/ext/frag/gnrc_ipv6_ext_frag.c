@@ -24,6 +24,7 @@
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/ext.h"
 #include "net/gnrc/ipv6/ext/frag.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pktbuf.h"
 #include "random.h"
@@ -712,7 +713,7 @@ static gnrc_pktsnip_t *_completed(gnrc_ipv6_ext_frag_rbuf_t *rbuf)
     gnrc_ipv6_ext_frag_limits_t *ptr =
             (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next->next;
     if (rbuf->last && (ptr->start == 0)) {
-        gnrc_pktsnip_t *res = NULL;
+        gnrc_pktsnip_t *res = NULL, *netif_snip;
 
         /* last and first fragment were received, so check if everything
          * in-between is there */
@@ -726,6 +727,12 @@ static gnrc_pktsnip_t *_completed(gnrc_ipv6_ext_frag_rbuf_t *rbuf)
         res = rbuf->pkt;
         /* rewrite length */
         rbuf->ipv6->len = byteorder_htons(rbuf->pkt_len);
+        netif_snip = gnrc_pktsnip_search_type(res, GNRC_NETTYPE_NETIF);
+        if (netif_snip != NULL) {
+            gnrc_netif_hdr_t *netif_hdr = netif_snip->data;
+
+            netif_hdr->flags |= GNRC_NETIF_HDR_FLAGS_REASSEMBLED;
+        }
         rbuf->pkt = NULL;
         if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
             _stats.fragments += clist_count(&rbuf->limits);
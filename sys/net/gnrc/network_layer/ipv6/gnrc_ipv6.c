@@ -30,9 +30,14 @@
 
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
+#include "net/gnrc/netif/rx_batch.h"
 #include "net/gnrc/ipv6/whitelist.h"
 #include "net/gnrc/ipv6/blacklist.h"
 
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+#include "net/gnrc/ipv6/dst_cache.h"
+#endif
+
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
 #include "net/gnrc/ipv6/ext/frag.h"
 #endif
@@ -199,6 +204,12 @@ static void *_event_loop(void *args)
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
                 _receive(msg.content.ptr);
                 break;
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                gnrc_netif_rx_batch_handle(msg.content.ptr, _receive);
+                break;
+#endif
 
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
@@ -323,6 +334,18 @@ static bool _is_ipv6_hdr(gnrc_pktsnip_t *hdr)
 #endif
 }
 
+/* packets looped back to the node itself never reach the device and the
+ * device only sees the first fragment of packets exceeding the MTU */
+static bool _csum_offloaded(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
+{
+    const ipv6_hdr_t *hdr = ipv6->data;
+
+    return (netif != NULL) && gnrc_netif_tx_csum_offloaded(netif) &&
+           (gnrc_pkt_len(ipv6) <= netif->ipv6.mtu) &&
+           !ipv6_addr_is_loopback(&hdr->dst) &&
+           (gnrc_netif_ipv6_addr_idx(netif, &hdr->dst) < 0);
+}
+
 static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
 {
     int res;
@@ -423,6 +446,10 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
         prev->next = payload;
         prev = payload;
     }
+    if (_csum_offloaded(netif, ipv6)) {
+        DEBUG("ipv6: checksum for upper header is inserted by device.\n");
+        return 0;
+    }
     DEBUG("ipv6: calculate checksum for upper header.\n");
     if ((res = gnrc_netreg_calc_csum(payload, ipv6)) < 0) {
         if (res != -ENOENT) {   /* if there is no checksum we are okay */
@@ -486,6 +513,22 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     gnrc_ipv6_nib_nc_t nce;
 
     DEBUG("ipv6: send unicast\n");
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    unsigned iface = (netif == NULL) ? 0 : netif->pid;
+    /* source address selection needed */
+    bool select_src = prep_hdr && ipv6_addr_is_unspecified(&ipv6_hdr->src);
+    /* get version before the NIB lookup, so a change in between is noticed */
+    uint32_t version = gnrc_ipv6_dst_cache_version();
+    gnrc_ipv6_dst_cache_t *entry = gnrc_ipv6_dst_cache_get(&ipv6_hdr->dst,
+                                                           iface);
+
+    if (entry != NULL) {
+        DEBUG("ipv6: next hop to %s is cached\n",
+              ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
+        nce = entry->nce;
+    }
+    else
+#endif  /* MODULE_GNRC_IPV6_DST_CACHE */
     if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
                                           &nce) < 0) {
         /* packet is released by NIB */
@@ -493,9 +536,29 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
               ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
         return;
     }
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    else {
+        entry = gnrc_ipv6_dst_cache_add(&ipv6_hdr->dst, iface, &nce, version);
+    }
+#endif  /* MODULE_GNRC_IPV6_DST_CACHE */
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    /* address changes do not invalidate the cache, so check that the cached
+     * source address is still assigned to the interface */
+    if (select_src && (entry != NULL) &&
+        !ipv6_addr_is_unspecified(&entry->src) &&
+        (gnrc_netif_ipv6_addr_idx(netif, &entry->src) >= 0)) {
+        ipv6_hdr->src = entry->src;
+    }
+#endif  /* MODULE_GNRC_IPV6_DST_CACHE */
     if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+        if (select_src && (entry != NULL)) {
+            /* remember selected source address for the next packet */
+            entry->src = ipv6_hdr->src;
+        }
+#endif  /* MODULE_GNRC_IPV6_DST_CACHE */
         DEBUG("ipv6: add interface header to packet\n");
         if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
                                      netif_hdr_flags)) == NULL) {
@@ -357,6 +357,11 @@ void _handle_adv_l2(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
         _tl2ao_changes_nce(nce, tl2ao, netif, l2addr_len)) {
         bool nce_was_incomplete =
             (_get_nud_state(nce) == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_INCOMPLETE);
+        if ((nce->l2addr_len != l2addr_len) ||
+            ((tl2ao != NULL) &&
+             (memcmp(nce->l2addr, tl2ao + 1, l2addr_len) != 0))) {
+            _nib_nc_dst_cache_invalidate(nce);
+        }
         if (tl2ao != NULL) {
             nce->l2addr_len = l2addr_len;
             memcpy(nce->l2addr, tl2ao + 1, l2addr_len);
@@ -441,6 +446,9 @@ void _set_reachable(gnrc_netif_t *netif, _nib_onl_entry_t *nce)
 void _set_nud_state(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
                     uint16_t state)
 {
+    if (_get_nud_state(nce) != state) {
+        _nib_nc_dst_cache_invalidate(nce);
+    }
     nce->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
     nce->info |= state;
 
@@ -54,6 +54,135 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+/*
+ * Hash tables over _nodes (keyed by address) and _dsts (keyed by prefix and
+ * prefix length), both with separate chaining. The links are kept outside of
+ * the entries, as those get cleared with memset(). All values are entry
+ * index + 1, 0 marks the end of a chain or an entry that is not indexed.
+ * Chains are sorted by entry index, so that lookups find the same entry as a
+ * linear search through the array would.
+ */
+typedef struct {
+    uint16_t *buckets;      /* first entry of each bucket */
+    uint16_t *chain;        /* next entry in the same bucket, per entry */
+    uint16_t *bucket_of;    /* bucket an entry is indexed in, per entry */
+    unsigned numof;         /* number of buckets (= number of entries) */
+} _index_t;
+
+static uint16_t _onl_buckets[CONFIG_GNRC_IPV6_NIB_NUMOF];
+static uint16_t _onl_chain[CONFIG_GNRC_IPV6_NIB_NUMOF];
+static uint16_t _onl_bucket_of[CONFIG_GNRC_IPV6_NIB_NUMOF];
+static const _index_t _onl_index = {
+    _onl_buckets, _onl_chain, _onl_bucket_of, CONFIG_GNRC_IPV6_NIB_NUMOF
+};
+
+static uint16_t _offl_buckets[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static uint16_t _offl_chain[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static uint16_t _offl_bucket_of[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static const _index_t _offl_index = {
+    _offl_buckets, _offl_chain, _offl_bucket_of,
+    CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF
+};
+/* number of indexed off-link entries per prefix length (1 to 128) */
+static uint16_t _offl_pfx_len_numof[IPV6_ADDR_BIT_LEN];
+
+static unsigned _index_hash(const _index_t *index, const ipv6_addr_t *addr,
+                            unsigned salt)
+{
+    /* byte order does not matter for hashing */
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32 ^ salt;
+
+    /* Fibonacci hashing, spreads similar addresses over all buckets */
+    hash *= 2654435769U;
+    return (hash >> 16) % index->numof;
+}
+
+static void _index_del(const _index_t *index, unsigned idx)
+{
+    unsigned bucket = index->bucket_of[idx];
+
+    if (bucket == 0) {
+        return;
+    }
+    for (uint16_t *link = &index->buckets[bucket - 1]; *link;
+         link = &index->chain[*link - 1]) {
+        if (*link == (idx + 1)) {
+            *link = index->chain[idx];
+            break;
+        }
+    }
+    index->chain[idx] = 0;
+    index->bucket_of[idx] = 0;
+}
+
+static void _index_add(const _index_t *index, unsigned idx, unsigned bucket)
+{
+    uint16_t *link = &index->buckets[bucket];
+
+    _index_del(index, idx);
+    /* keep chain sorted by index */
+    while (*link && (*link < (idx + 1))) {
+        link = &index->chain[*link - 1];
+    }
+    index->chain[idx] = *link;
+    *link = idx + 1;
+    index->bucket_of[idx] = bucket + 1;
+}
+
+static void _nib_onl_index(_nib_onl_entry_t *node)
+{
+    unsigned idx = node - _nodes;
+
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        _index_del(&_onl_index, idx);
+    }
+    else {
+        _index_add(&_onl_index, idx,
+                   _index_hash(&_onl_index, &node->ipv6, 0));
+    }
+}
+
+void _nib_onl_unindex(_nib_onl_entry_t *node)
+{
+    _index_del(&_onl_index, node - _nodes);
+}
+
+static void _nib_offl_index(_nib_offl_entry_t *dst)
+{
+    ipv6_addr_t pfx = IPV6_ADDR_UNSPECIFIED;
+
+    ipv6_addr_init_prefix(&pfx, &dst->pfx, dst->pfx_len);
+    _index_add(&_offl_index, dst - _dsts,
+               _index_hash(&_offl_index, &pfx, dst->pfx_len));
+    _offl_pfx_len_numof[dst->pfx_len - 1]++;
+}
+
+static void _nib_offl_unindex(_nib_offl_entry_t *dst)
+{
+    unsigned idx = dst - _dsts;
+
+    if (_offl_bucket_of[idx]) {
+        _index_del(&_offl_index, idx);
+        _offl_pfx_len_numof[dst->pfx_len - 1]--;
+    }
+}
+
+#ifdef TEST_SUITES
+static void _index_init(void)
+{
+    memset(_onl_buckets, 0, sizeof(_onl_buckets));
+    memset(_onl_chain, 0, sizeof(_onl_chain));
+    memset(_onl_bucket_of, 0, sizeof(_onl_bucket_of));
+    memset(_offl_buckets, 0, sizeof(_offl_buckets));
+    memset(_offl_chain, 0, sizeof(_offl_chain));
+    memset(_offl_bucket_of, 0, sizeof(_offl_bucket_of));
+    memset(_offl_pfx_len_numof, 0, sizeof(_offl_pfx_len_numof));
+}
+#endif  /* TEST_SUITES */
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
+
 void _nib_init(void)
 {
 #ifdef TEST_SUITES
@@ -65,6 +194,9 @@ void _nib_init(void)
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+    _index_init();
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
@@ -214,20 +346,42 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
     return NULL;
 }
 
+static inline bool _onl_matches(const _nib_onl_entry_t *node,
+                                const ipv6_addr_t *addr, unsigned iface)
+{
+    return (node->mode != _EMPTY) &&
+           /* either requested or current interface undefined or
+            * interfaces equal */
+           ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+            (_nib_onl_get_if(node) == iface)) &&
+           ipv6_addr_equal(&node->ipv6, addr);
+}
+
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
 {
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+    /* entries with unspecified address are not indexed */
+    if (!ipv6_addr_is_unspecified(addr)) {
+        for (unsigned i = _onl_buckets[_index_hash(&_onl_index, addr, 0)];
+             i != 0; i = _onl_chain[i - 1]) {
+            _nib_onl_entry_t *node = &_nodes[i - 1];
+
+            if (_onl_matches(node, addr, iface)) {
+                DEBUG("  Found %p\n", (void *)node);
+                return node;
+            }
+        }
+        DEBUG("  No suitable entry found\n");
+        return NULL;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
-        if ((node->mode != _EMPTY) &&
-            /* either requested or current interface undefined or
-             * interfaces equal */
-            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
-             (_nib_onl_get_if(node) == iface)) &&
-            ipv6_addr_equal(&node->ipv6, addr)) {
+        if (_onl_matches(node, addr, iface)) {
             DEBUG("  Found %p\n", (void *)node);
             return node;
         }
@@ -264,6 +418,7 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
     DEBUG("nib: remove from neighbor cache (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, &node->ipv6, sizeof(addr_str)),
           _nib_onl_get_if(node));
+    _nib_nc_dst_cache_invalidate(node);
     node->mode &= ~(_NC);
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->snd_na.event);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
@@ -367,6 +522,8 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
         if (def_router->next_hop == NULL) {
             return NULL;
         }
+        /* may become the default route */
+        gnrc_ipv6_dst_cache_invalidate();
         _override_node(router_addr, iface, def_router->next_hop);
         def_router->next_hop->mode |= _DRL;
     }
@@ -375,6 +532,7 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
 
 void _nib_drl_remove(_nib_dr_entry_t *nib_dr)
 {
+    gnrc_ipv6_dst_cache_invalidate();
     if (nib_dr->next_hop != NULL) {
         nib_dr->next_hop->mode &= ~(_DRL);
         _nib_onl_clear(nib_dr->next_hop);
@@ -493,7 +651,13 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
+                if (!ipv6_addr_equal(&tmp_node->ipv6, next_hop)) {
+                    gnrc_ipv6_dst_cache_invalidate();
+                }
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+                _nib_onl_index(tmp_node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -510,10 +674,14 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             memset(dst, 0, sizeof(_nib_offl_entry_t));
             return NULL;
         }
+        gnrc_ipv6_dst_cache_invalidate();
         _override_node(next_hop, iface, dst->next_hop);
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+        _nib_offl_index(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
     }
     return dst;
 }
@@ -538,6 +706,7 @@ static inline bool _in_abrs(const _nib_abr_entry_t *abr)
 void _nib_offl_clear(_nib_offl_entry_t *dst)
 {
     if (dst->next_hop != NULL) {
+        gnrc_ipv6_dst_cache_invalidate();
         _nib_offl_entry_t *ptr;
         for (ptr = _dsts; _in_dsts(ptr); ptr++) {
             /* there is another dst pointing to next-hop => only remove dst */
@@ -550,6 +719,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+        _nib_offl_unindex(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -573,13 +745,50 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+_nib_offl_entry_t *_nib_offl_lpm(const ipv6_addr_t *dst,
+                                 bool (*filter)(const _nib_offl_entry_t *))
+{
+    assert((dst != NULL) && (filter != NULL));
+    for (unsigned pfx_len = IPV6_ADDR_BIT_LEN; pfx_len > 0; pfx_len--) {
+        ipv6_addr_t pfx = IPV6_ADDR_UNSPECIFIED;
+
+        if (_offl_pfx_len_numof[pfx_len - 1] == 0) {
+            continue;
+        }
+        ipv6_addr_init_prefix(&pfx, dst, pfx_len);
+        for (unsigned i = _offl_buckets[_index_hash(&_offl_index, &pfx,
+                                                    pfx_len)];
+             i != 0; i = _offl_chain[i - 1]) {
+            _nib_offl_entry_t *entry = &_dsts[i - 1];
+
+            if ((entry->pfx_len == pfx_len) &&
+                (ipv6_addr_match_prefix(&entry->pfx, dst) >= pfx_len) &&
+                filter(entry)) {
+                return entry;
+            }
+        }
+    }
+    return NULL;
+}
+
+static bool _offl_not_empty(const _nib_offl_entry_t *entry)
+{
+    return (entry->mode != _EMPTY);
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
+
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
     _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+    res = _nib_offl_lpm(dst, _offl_not_empty);
+#else   /* CONFIG_GNRC_IPV6_NIB_INDEX */
+    uint8_t best_match = 0;
+
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -599,6 +808,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
             }
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
     return res;
 }
 
@@ -827,6 +1037,9 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
     _nib_onl_clear(node);
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+        _nib_onl_index(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
     }
     _nib_onl_set_if(node, iface);
 }
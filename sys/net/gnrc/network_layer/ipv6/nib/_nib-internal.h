@@ -34,6 +34,7 @@
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
 #endif
+#include "net/gnrc/ipv6/dst_cache.h"
 #include "net/gnrc/ipv6/nib/ft.h"
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -311,6 +312,17 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX) || defined(DOXYGEN)
+/**
+ * @brief   Removes an on-link entry from the address index
+ *
+ * @note    Only available with @ref CONFIG_GNRC_IPV6_NIB_INDEX.
+ *
+ * @param[in] node  An entry.
+ */
+void _nib_onl_unindex(_nib_onl_entry_t *node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -322,12 +334,35 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+        _nib_onl_unindex(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
     return false;
 }
 
+/**
+ * @brief   Invalidates the @ref net_gnrc_ipv6_dst_cache before a neighbor
+ *          cache entry is changed, if it may be cached as next hop
+ *
+ * Only neighbors in NUD states REACHABLE and UNMANAGED are cached.
+ *
+ * @param[in] node  An entry.
+ */
+static inline void _nib_nc_dst_cache_invalidate(const _nib_onl_entry_t *node)
+{
+    switch (node->info & GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK) {
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE:
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED:
+            gnrc_ipv6_dst_cache_invalidate();
+            break;
+        default:
+            break;
+    }
+}
+
 /**
  * @brief   Iterates over on-link entries
  *
@@ -777,6 +812,28 @@ _nib_abr_entry_t *_nib_abr_iter(const _nib_abr_entry_t *last);
  */
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX) || defined(DOXYGEN)
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * Of several entries with the same prefix, the one coming first in
+ * iteration order (see @ref _nib_offl_iter()) is returned.
+ *
+ * @note    Only available with @ref CONFIG_GNRC_IPV6_NIB_INDEX.
+ *
+ * @pre `(dst != NULL) && (filter != NULL)`
+ *
+ * @param[in] dst       Destination address to match.
+ * @param[in] filter    Only entries for which @p filter returns true are
+ *                      considered.
+ *
+ * @return  The best matching entry.
+ * @return  NULL, if no entry matches.
+ */
+_nib_offl_entry_t *_nib_offl_lpm(const ipv6_addr_t *dst,
+                                 bool (*filter)(const _nib_offl_entry_t *));
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
+
 /**
  * @brief   Gets best match to @p dst from all off-link entries and default
  *          route.
@@ -165,10 +165,16 @@ void gnrc_ipv6_nib_init_iface(gnrc_netif_t *netif)
     gnrc_netif_release(netif);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+static bool _is_on_link_pfx(const _nib_offl_entry_t *entry)
+{
+    return (entry->mode & _PL) && (entry->flags & _PFX_ON_LINK);
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
+
 static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
 {
     _nib_offl_entry_t *entry = NULL;
-    uint8_t best_pfx = 0;
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LN)
     if (*iface != 0) {
@@ -177,6 +183,14 @@ static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
         }
     }
 #endif  /* CONFIG_GNRC_IPV6_NIB_6LN */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+    if ((entry = _nib_offl_lpm(dst, _is_on_link_pfx))) {
+        *iface = _nib_onl_get_if(entry->next_hop);
+        return true;
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_INDEX */
+    uint8_t best_pfx = 0;
+
     while ((entry = _nib_offl_iter(entry))) {
         if ((entry->mode & _PL) && (entry->flags & _PFX_ON_LINK) &&
             (ipv6_addr_match_prefix(dst, &entry->pfx) >= entry->pfx_len) &&
@@ -188,6 +202,7 @@ static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
     if (best_pfx) {
         return true;
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
     return ipv6_addr_is_link_local(dst);
 }
 
@@ -12,9 +12,11 @@
  * @file
  */
 
+#include <assert.h>
 #include <stdbool.h>
 #include <inttypes.h>
 
+#include "atomic_utils.h"
 #include "mutex.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -30,6 +32,10 @@
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
 static mutex_t _ctx_mutex = MUTEX_INIT;
+/* removals may happen in interrupt context, so this is accessed atomically */
+static volatile uint16_t _generation;
+/* lifetimes expire with the minute, so the generation changes with it */
+static uint32_t _generation_minute;
 
 static uint32_t _current_minute(void);
 static void _update_lifetime(uint8_t id);
@@ -129,11 +135,32 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
     _ctx_inval_times[id] = ltime + _current_minute();
+    atomic_fetch_add_u16(&_generation, 1);
 
     mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
 }
 
+void gnrc_sixlowpan_ctx_remove(uint8_t id)
+{
+    assert(id < GNRC_SIXLOWPAN_CTX_SIZE);
+    _ctxs[id].prefix_len = 0;
+    atomic_fetch_add_u16(&_generation, 1);
+}
+
+uint16_t gnrc_sixlowpan_ctx_generation(void)
+{
+    uint32_t now = _current_minute();
+
+    mutex_lock(&_ctx_mutex);
+    if (now != _generation_minute) {
+        _generation_minute = now;
+        atomic_fetch_add_u16(&_generation, 1);
+    }
+    mutex_unlock(&_ctx_mutex);
+    return atomic_load_u16(&_generation);
+}
+
 static uint32_t _current_minute(void)
 {
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -170,6 +197,7 @@ static void _update_lifetime(uint8_t id)
 void gnrc_sixlowpan_ctx_reset(void)
 {
     memset(_ctxs, 0, sizeof(_ctxs));
+    atomic_fetch_add_u16(&_generation, 1);
 }
 #endif
 
@@ -28,6 +28,7 @@
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/netif.h"
+#include "net/gnrc/netif/rx_batch.h"
 #include "net/sixlowpan.h"
 
 #define ENABLE_DEBUG 0
@@ -412,6 +413,12 @@ static void *_event_loop(void *args)
                 DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
                 _receive(msg.content.ptr);
                 break;
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("6lo: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                gnrc_netif_rx_batch_handle(msg.content.ptr, _receive);
+                break;
+#endif
 
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
@@ -132,7 +132,7 @@ static inline bool _is_rfrag(gnrc_pktsnip_t *sixlo)
 }
 
 static inline bool _context_overlaps_iid(gnrc_sixlowpan_ctx_t *ctx,
-                                         ipv6_addr_t *addr,
+                                         const ipv6_addr_t *addr,
                                          eui64_t *iid)
 {
     uint8_t byte_mask[] = {0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01};
@@ -1035,21 +1035,30 @@ static inline bool _compressible_nh(uint8_t nh)
     }
 }
 
-static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
-                                const gnrc_netif_hdr_t *netif_hdr,
-                                gnrc_netif_t *iface,
-                                uint8_t *iphc_hdr)
+/**
+ * @brief   Compressed source and destination address of an IPv6 header
+ */
+typedef struct {
+    uint8_t iphc2;      /**< SAC, SAM, M, DAC and DAM bits of IPHC header */
+    uint8_t cid;        /**< context identifier extension */
+    bool cid_ext;       /**< context identifier extension is used */
+    uint8_t len;        /**< length of _iphc_addrs_t::fields */
+    /**
+     * @brief   inline source and destination address fields
+     */
+    uint8_t fields[2 * sizeof(ipv6_addr_t)];
+} _iphc_addrs_t;
+
+static bool _iphc_addrs_encode(const ipv6_hdr_t *ipv6_hdr,
+                               const gnrc_netif_hdr_t *netif_hdr,
+                               gnrc_netif_t *iface, _iphc_addrs_t *addrs)
 {
     gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
-    ipv6_hdr_t *ipv6_hdr = pkt->next->data;
     bool addr_comp = false;
-    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
-
-    assert(iface != NULL);
 
-    /* set initial dispatch value*/
-    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
-    iphc_hdr[IPHC2_IDX] = 0;
+    addrs->iphc2 = 0;
+    addrs->cid = 0;
+    addrs->len = 0;
 
     /* check for available contexts */
     if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
@@ -1070,89 +1079,22 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         }
     }
 
-    /* if contexts available and both != 0 */
-    /* since this moves inline_pos we have to do this ahead*/
-    if (((src_ctx != NULL) &&
-            ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
-        ((dst_ctx != NULL) &&
-            ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
-        /* add context identifier extension */
-        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
-        iphc_hdr[CID_EXT_IDX] = 0;
-
-        /* move position to behind CID extension */
-        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
-    }
-
-    /* compress flow label and traffic class */
-    if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
-        if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
-            /* elide both traffic class and flow label */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_ELIDE;
-        }
-        else {
-            /* elide flow label, traffic class (ECN + DSCP) inline (1 byte) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP;
-            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
-        }
-    }
-    else {
-        if (ipv6_hdr_get_tc_dscp(ipv6_hdr) == 0) {
-            /* elide DSCP, ECN + 2-bit pad + flow label inline (3 byte) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_FL;
-            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_tc_ecn(ipv6_hdr) << 6) |
-                                               ((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16));
-        }
-        else {
-            /* ECN + DSCP + 4-bit pad + flow label (4 bytes) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP_FL;
-            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
-            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16);
-        }
-
-        /* copy remaining bytes of flow label */
-        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x0000ff00) >> 8);
-        iphc_hdr[inline_pos++] = (uint8_t)(ipv6_hdr_get_fl(ipv6_hdr) & 0x000000ff);
-    }
-
-    /* check for compressible next header */
-    if (_compressible_nh(ipv6_hdr->nh)) {
-        iphc_hdr[IPHC1_IDX] |= SIXLOWPAN_IPHC1_NH;
-    }
-    else {
-        iphc_hdr[inline_pos++] = ipv6_hdr->nh;
-    }
-
-    /* compress hop limit */
-    switch (ipv6_hdr->hl) {
-        case 1:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_1;
-            break;
-
-        case 64:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_64;
-            break;
-
-        case 255:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_255;
-            break;
-
-        default:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_INLINE;
-            iphc_hdr[inline_pos++] = ipv6_hdr->hl;
-            break;
-    }
+    /* if contexts available and both != 0 add context identifier extension */
+    addrs->cid_ext = ((src_ctx != NULL) &&
+                      ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
+                     ((dst_ctx != NULL) &&
+                      ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0));
 
     if (ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
-        iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_UNSPEC;
+        addrs->iphc2 |= IPHC_SAC_SAM_UNSPEC;
     }
     else {
         if (src_ctx != NULL) {
             /* stateful source address compression */
-            iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_SAC;
+            addrs->iphc2 |= SIXLOWPAN_IPHC2_SAC;
 
             if (((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) {
-                iphc_hdr[CID_EXT_IDX] |= ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) << 4);
+                addrs->cid |= ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) << 4);
             }
         }
 
@@ -1164,38 +1106,38 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
             if (gnrc_netif_ipv6_get_iid(iface, &iid) < 0) {
                 DEBUG("6lo iphc: could not get interface's IID\n");
                 gnrc_netif_release(iface);
-                return 0;
+                return false;
             }
             gnrc_netif_release(iface);
 
             if ((ipv6_hdr->src.u64[1].u64 == iid.uint64.u64) ||
                 _context_overlaps_iid(src_ctx, &ipv6_hdr->src, &iid)) {
                 /* 0 bits. The address is derived from link-layer address */
-                iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_L2;
+                addrs->iphc2 |= IPHC_SAC_SAM_L2;
                 addr_comp = true;
             }
             else if ((byteorder_ntohl(ipv6_hdr->src.u32[2]) == 0x000000ff) &&
                      (byteorder_ntohs(ipv6_hdr->src.u16[6]) == 0xfe00)) {
                 /* 16 bits. The address is derived using 16 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_16;
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->src.u16 + 7, 2);
-                inline_pos += 2;
+                addrs->iphc2 |= IPHC_SAC_SAM_16;
+                memcpy(addrs->fields + addrs->len, ipv6_hdr->src.u16 + 7, 2);
+                addrs->len += 2;
                 addr_comp = true;
             }
             else {
                 /* 64 bits. The address is derived using 64 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_64;
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->src.u64 + 1, 8);
-                inline_pos += 8;
+                addrs->iphc2 |= IPHC_SAC_SAM_64;
+                memcpy(addrs->fields + addrs->len, ipv6_hdr->src.u64 + 1, 8);
+                addrs->len += 8;
                 addr_comp = true;
             }
         }
 
         if (!addr_comp) {
             /* full address is carried inline */
-            iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_FULL;
-            memcpy(iphc_hdr + inline_pos, &ipv6_hdr->src, 16);
-            inline_pos += 16;
+            addrs->iphc2 |= IPHC_SAC_SAM_FULL;
+            memcpy(addrs->fields + addrs->len, &ipv6_hdr->src, 16);
+            addrs->len += 16;
         }
     }
 
@@ -1203,7 +1145,7 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
 
     /* M: Multicast compression */
     if (ipv6_addr_is_multicast(&(ipv6_hdr->dst))) {
-        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_M;
+        addrs->iphc2 |= SIXLOWPAN_IPHC2_M;
 
         /* if multicast address is of format ffXX::XXXX:XXXX:XXXX */
         if ((ipv6_hdr->dst.u16[1].u16 == 0) &&
@@ -1215,27 +1157,27 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                 (ipv6_hdr->dst.u16[6].u16 == 0) &&
                 (ipv6_hdr->dst.u8[14] == 0)) {
                 /* 8 bits. The address is derived using 8 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_M_8;
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[15];
+                addrs->iphc2 |= IPHC_M_DAC_DAM_M_8;
+                addrs->fields[addrs->len++] = ipv6_hdr->dst.u8[15];
                 addr_comp = true;
             }
             /* if multicast address is of format ffXX::XX:XXXX */
             else if ((ipv6_hdr->dst.u16[5].u16 == 0) &&
                      (ipv6_hdr->dst.u8[12] == 0)) {
                 /* 32 bits. The address is derived using 32 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_M_32;
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[1];
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->dst.u8 + 13, 3);
-                inline_pos += 3;
+                addrs->iphc2 |= IPHC_M_DAC_DAM_M_32;
+                addrs->fields[addrs->len++] = ipv6_hdr->dst.u8[1];
+                memcpy(addrs->fields + addrs->len, ipv6_hdr->dst.u8 + 13, 3);
+                addrs->len += 3;
                 addr_comp = true;
             }
             /* if multicast address is of format ffXX::XX:XXXX:XXXX */
             else if (ipv6_hdr->dst.u8[10] == 0) {
                 /* 48 bits. The address is derived using 48 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_M_48;
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[1];
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->dst.u8 + 11, 5);
-                inline_pos += 5;
+                addrs->iphc2 |= IPHC_M_DAC_DAM_M_48;
+                addrs->fields[addrs->len++] = ipv6_hdr->dst.u8[1];
+                memcpy(addrs->fields + addrs->len, ipv6_hdr->dst.u8 + 11, 5);
+                addrs->len += 5;
                 addr_comp = true;
             }
         }
@@ -1255,14 +1197,14 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                 /* Unicast prefix based IPv6 multicast address
                  * (https://tools.ietf.org/html/rfc3306) with given context
                  * for unicast prefix -> context based compression */
-                iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
+                addrs->iphc2 |= SIXLOWPAN_IPHC2_DAC;
                 if ((ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0) {
-                    iphc_hdr[CID_EXT_IDX] |= (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
+                    addrs->cid |= (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
                 }
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[1];
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[2];
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->dst.u16 + 6, 4);
-                inline_pos += 4;
+                addrs->fields[addrs->len++] = ipv6_hdr->dst.u8[1];
+                addrs->fields[addrs->len++] = ipv6_hdr->dst.u8[2];
+                memcpy(addrs->fields + addrs->len, ipv6_hdr->dst.u16 + 6, 4);
+                addrs->len += 4;
                 addr_comp = true;
             }
         }
@@ -1273,48 +1215,235 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
 
         if (dst_ctx != NULL) {
             /* stateful destination address compression */
-            iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
+            addrs->iphc2 |= SIXLOWPAN_IPHC2_DAC;
 
             if (((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) {
-                iphc_hdr[CID_EXT_IDX] |= (dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
+                addrs->cid |= (dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
             }
         }
 
         if (gnrc_netif_hdr_ipv6_iid_from_dst(iface, netif_hdr, &iid) < 0) {
             DEBUG("6lo iphc: could not get destination's IID\n");
-            return 0;
+            return false;
         }
 
         if ((ipv6_hdr->dst.u64[1].u64 == iid.uint64.u64) ||
             _context_overlaps_iid(dst_ctx, &(ipv6_hdr->dst), &iid)) {
             /* 0 bits. The address is derived using the link-layer address */
-            iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_U_L2;
+            addrs->iphc2 |= IPHC_M_DAC_DAM_U_L2;
             addr_comp = true;
         }
         else if ((byteorder_ntohl(ipv6_hdr->dst.u32[2]) == 0x000000ff) &&
                  (byteorder_ntohs(ipv6_hdr->dst.u16[6]) == 0xfe00)) {
             /* 16 bits. The address is derived using 16 bits carried inline */
-            iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_U_16;
-            memcpy(&(iphc_hdr[inline_pos]), &(ipv6_hdr->dst.u16[7]), 2);
-            inline_pos += 2;
+            addrs->iphc2 |= IPHC_M_DAC_DAM_U_16;
+            memcpy(addrs->fields + addrs->len, &(ipv6_hdr->dst.u16[7]), 2);
+            addrs->len += 2;
             addr_comp = true;
         }
         else {
             /* 64 bits. The address is derived using 64 bits carried inline */
-            iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_U_64;
-            memcpy(&(iphc_hdr[inline_pos]), &(ipv6_hdr->dst.u8[8]), 8);
-            inline_pos += 8;
+            addrs->iphc2 |= IPHC_M_DAC_DAM_U_64;
+            memcpy(addrs->fields + addrs->len, &(ipv6_hdr->dst.u8[8]), 8);
+            addrs->len += 8;
             addr_comp = true;
         }
     }
 
     if (!addr_comp) {
         /* full destination address is carried inline */
-        iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_FULL;
-        memcpy(iphc_hdr + inline_pos, &ipv6_hdr->dst, 16);
-        inline_pos += 16;
+        addrs->iphc2 |= IPHC_SAC_SAM_FULL;
+        memcpy(addrs->fields + addrs->len, &ipv6_hdr->dst, 16);
+        addrs->len += 16;
     }
 
+    return true;
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+/**
+ * @brief   Address compression of a flow
+ *
+ * Everything the address compression depends on, apart from the contexts,
+ * is part of the key.
+ */
+typedef struct {
+    const gnrc_netif_t *iface;  /**< interface, NULL for an empty entry */
+    ipv6_addr_t src;            /**< source address */
+    ipv6_addr_t dst;            /**< destination address */
+    /**
+     * @brief   link-layer address of gnrc_netif_t::iface, the source IID is
+     *          derived from
+     */
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];
+    uint8_t dst_l2addr[GNRC_NETIF_L2ADDR_MAXLEN]; /**< link-layer destination */
+    uint8_t l2addr_len;         /**< length of _iphc_cache_entry_t::l2addr */
+    uint8_t dst_l2addr_len;     /**< length of _iphc_cache_entry_t::dst_l2addr */
+    uint16_t ctx_gen;           /**< generation of the contexts */
+    _iphc_addrs_t addrs;        /**< the compressed addresses */
+} _iphc_cache_entry_t;
+
+static _iphc_cache_entry_t _iphc_cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static unsigned _iphc_cache_next;
+
+static bool _iphc_cache_match(const _iphc_cache_entry_t *entry,
+                              const ipv6_hdr_t *ipv6_hdr,
+                              const gnrc_netif_hdr_t *netif_hdr,
+                              const gnrc_netif_t *iface, uint16_t ctx_gen)
+{
+    return (entry->iface == iface) && (entry->ctx_gen == ctx_gen) &&
+           ipv6_addr_equal(&entry->src, &ipv6_hdr->src) &&
+           ipv6_addr_equal(&entry->dst, &ipv6_hdr->dst) &&
+           (entry->dst_l2addr_len == netif_hdr->dst_l2addr_len) &&
+           (memcmp(entry->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                   netif_hdr->dst_l2addr_len) == 0) &&
+           (entry->l2addr_len == iface->l2addr_len) &&
+           (memcmp(entry->l2addr, iface->l2addr, iface->l2addr_len) == 0);
+}
+
+static const _iphc_addrs_t *_iphc_cache_get(const ipv6_hdr_t *ipv6_hdr,
+                                            const gnrc_netif_hdr_t *netif_hdr,
+                                            gnrc_netif_t *iface)
+{
+    uint16_t ctx_gen = gnrc_sixlowpan_ctx_generation();
+    _iphc_cache_entry_t *entry;
+
+    if (netif_hdr->dst_l2addr_len > GNRC_NETIF_L2ADDR_MAXLEN) {
+        return NULL;
+    }
+    gnrc_netif_acquire(iface);
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        if (_iphc_cache_match(&_iphc_cache[i], ipv6_hdr, netif_hdr, iface,
+                              ctx_gen)) {
+            gnrc_netif_release(iface);
+            return &_iphc_cache[i].addrs;
+        }
+    }
+    /* replace the entries in turn */
+    entry = &_iphc_cache[_iphc_cache_next];
+    _iphc_cache_next = (_iphc_cache_next + 1) %
+                       CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+    entry->l2addr_len = iface->l2addr_len;
+    memcpy(entry->l2addr, iface->l2addr, iface->l2addr_len);
+    gnrc_netif_release(iface);
+    if (!_iphc_addrs_encode(ipv6_hdr, netif_hdr, iface, &entry->addrs)) {
+        entry->iface = NULL;
+        return NULL;
+    }
+    entry->iface = iface;
+    entry->src = ipv6_hdr->src;
+    entry->dst = ipv6_hdr->dst;
+    entry->dst_l2addr_len = netif_hdr->dst_l2addr_len;
+    memcpy(entry->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+    entry->ctx_gen = ctx_gen;
+    return &entry->addrs;
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+
+static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
+                                const gnrc_netif_hdr_t *netif_hdr,
+                                gnrc_netif_t *iface,
+                                uint8_t *iphc_hdr)
+{
+    ipv6_hdr_t *ipv6_hdr = pkt->next->data;
+    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+    const _iphc_addrs_t *addrs;
+
+    assert(iface != NULL);
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+    /* steady-state flows skip the context lookups and IID derivations */
+    addrs = _iphc_cache_get(ipv6_hdr, netif_hdr, iface);
+    if (addrs == NULL) {
+        return 0;
+    }
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+    _iphc_addrs_t addrs_buf;
+
+    if (!_iphc_addrs_encode(ipv6_hdr, netif_hdr, iface, &addrs_buf)) {
+        return 0;
+    }
+    addrs = &addrs_buf;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+
+    /* set initial dispatch value*/
+    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
+    iphc_hdr[IPHC2_IDX] = addrs->iphc2;
+
+    /* since this moves inline_pos we have to do this ahead*/
+    if (addrs->cid_ext) {
+        /* add context identifier extension */
+        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
+        iphc_hdr[CID_EXT_IDX] = addrs->cid;
+
+        /* move position to behind CID extension */
+        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+
+    /* compress flow label and traffic class */
+    if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
+        if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
+            /* elide both traffic class and flow label */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_ELIDE;
+        }
+        else {
+            /* elide flow label, traffic class (ECN + DSCP) inline (1 byte) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP;
+            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+        }
+    }
+    else {
+        if (ipv6_hdr_get_tc_dscp(ipv6_hdr) == 0) {
+            /* elide DSCP, ECN + 2-bit pad + flow label inline (3 byte) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_FL;
+            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_tc_ecn(ipv6_hdr) << 6) |
+                                               ((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16));
+        }
+        else {
+            /* ECN + DSCP + 4-bit pad + flow label (4 bytes) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP_FL;
+            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16);
+        }
+
+        /* copy remaining bytes of flow label */
+        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x0000ff00) >> 8);
+        iphc_hdr[inline_pos++] = (uint8_t)(ipv6_hdr_get_fl(ipv6_hdr) & 0x000000ff);
+    }
+
+    /* check for compressible next header */
+    if (_compressible_nh(ipv6_hdr->nh)) {
+        iphc_hdr[IPHC1_IDX] |= SIXLOWPAN_IPHC1_NH;
+    }
+    else {
+        iphc_hdr[inline_pos++] = ipv6_hdr->nh;
+    }
+
+    /* compress hop limit */
+    switch (ipv6_hdr->hl) {
+        case 1:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_1;
+            break;
+
+        case 64:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_64;
+            break;
+
+        case 255:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_255;
+            break;
+
+        default:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_INLINE;
+            iphc_hdr[inline_pos++] = ipv6_hdr->hl;
+            break;
+    }
+
+    /* source and destination address */
+    memcpy(iphc_hdr + inline_pos, addrs->fields, addrs->len);
+    inline_pos += addrs->len;
+
     return inline_pos;
 }
 
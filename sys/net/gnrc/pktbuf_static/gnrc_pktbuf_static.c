@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <sys/types.h>
 
+#include "kernel_defines.h"
 #include "mutex.h"
 #include "od.h"
 #include "utlist.h"
@@ -43,15 +44,33 @@ static uintptr_t _pktbuf_buf[CONFIG_GNRC_PKTBUF_SIZE / sizeof(uintptr_t)];
 uint8_t *gnrc_pktbuf_static_buf = (uint8_t *)_pktbuf_buf;
 static _unused_t *_first_unused;
 
+#if IS_ACTIVE(CONFIG_GNRC_PKTBUF_SIZE_CLASSES) && (CONFIG_GNRC_PKTBUF_SIZE_CLASS_DEPTH > 0)
+/* freed small chunks are kept in one list per size */
+#define SIZE_CLASS_LISTS
+/* one size class per multiple of the alignment up to
+ * CONFIG_GNRC_PKTBUF_SIZE_CLASS_MAX */
+#define SIZE_CLASSES_NUMOF  (CONFIG_GNRC_PKTBUF_SIZE_CLASS_MAX / sizeof(_unused_t))
+/* freed chunks of exactly (i + 1) * sizeof(_unused_t) bytes that are not in
+ * the list of _first_unused (LIFO, _unused_t::size is not maintained) */
+static _unused_t *_classes[SIZE_CLASSES_NUMOF];
+/* number of chunks in _classes[i] */
+static uint8_t _classes_len[SIZE_CLASSES_NUMOF];
+#endif
+
 #ifdef DEVELHELP
 /* maximum number of bytes allocated */
 static uint16_t max_byte_count = 0;
+/* number of failed allocations */
+static unsigned _alloc_failed = 0;
+/* number of failed allocations with enough free bytes in total */
+static unsigned _alloc_failed_frag = 0;
 #endif
 
 /* internal gnrc_pktbuf functions */
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
                                     gnrc_nettype_t type);
 static void *_pktbuf_alloc(size_t size);
+static void _free_unused(void *data, size_t size);
 
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
@@ -72,6 +91,10 @@ void gnrc_pktbuf_init(void)
     _first_unused = (_unused_t *)_pktbuf_buf;
     _first_unused->next = NULL;
     _first_unused->size = sizeof(_pktbuf_buf);
+#ifdef SIZE_CLASS_LISTS
+    memset(_classes, 0, sizeof(_classes));
+    memset(_classes_len, 0, sizeof(_classes_len));
+#endif
     mutex_unlock(&gnrc_pktbuf_mutex);
 }
 
@@ -158,8 +181,10 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 
     mutex_lock(&gnrc_pktbuf_mutex);
     assert(pkt != NULL);
+    /* data may lie outside of the buffer for zero-copy snips, it is only
+     * freed if it is part of the buffer */
     assert(((pkt->size == 0) && (pkt->data == NULL)) ||
-           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+           ((pkt->size > 0) && (pkt->data != NULL)));
     /* new size and old size are equal */
     if (size == pkt->size) {
         /* nothing to do */
@@ -225,6 +250,37 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
     return pkt;
 }
 
+#ifdef SIZE_CLASS_LISTS
+static inline unsigned _class(size_t aligned_size)
+{
+    return (aligned_size / sizeof(_unused_t)) - 1;
+}
+
+/* returns all chunks in the size classes to the list of _first_unused, so
+ * they can be merged with their neighbors */
+static bool _flush_classes(void)
+{
+    bool flushed = false;
+
+    for (unsigned i = 0; i < SIZE_CLASSES_NUMOF; i++) {
+        while (_classes[i] != NULL) {
+            _unused_t *chunk = _classes[i];
+
+            _classes[i] = chunk->next;
+            _classes_len[i]--;
+            _free_unused(chunk, (i + 1) * sizeof(_unused_t));
+            flushed = true;
+        }
+    }
+    return flushed;
+}
+#else
+static inline bool _flush_classes(void)
+{
+    return false;
+}
+#endif
+
 #ifdef DEVELHELP
 #ifdef MODULE_OD
 static inline void _print_chunk(void *chunk, size_t size, int num)
@@ -256,6 +312,21 @@ static inline void _print_unused(_unused_t *ptr)
 
 void gnrc_pktbuf_stats(void)
 {
+    unsigned free_bytes = 0, free_chunks = 0, largest = 0;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    _flush_classes();
+    for (_unused_t *ptr = _first_unused; ptr != NULL; ptr = ptr->next) {
+        free_bytes += ptr->size;
+        free_chunks++;
+        if (ptr->size > largest) {
+            largest = ptr->size;
+        }
+    }
+    printf("packet buffer: %u bytes free in %u chunks (largest: %u), "
+           "%u failed allocations (%u due to fragmentation)\n",
+           free_bytes, free_chunks, largest, _alloc_failed, _alloc_failed_frag);
+    mutex_unlock(&gnrc_pktbuf_mutex);
 #ifdef MODULE_OD
     _unused_t *ptr = _first_unused;
     uint8_t *chunk = &gnrc_pktbuf_static_buf[0];
@@ -301,8 +372,14 @@ void gnrc_pktbuf_stats(void)
 #ifdef TEST_SUITES
 bool gnrc_pktbuf_is_empty(void)
 {
-    return (_first_unused == (_unused_t *)gnrc_pktbuf_static_buf) &&
-           (_first_unused->size == sizeof(_pktbuf_buf));
+    bool res;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    _flush_classes();
+    res = (_first_unused == (_unused_t *)gnrc_pktbuf_static_buf) &&
+          (_first_unused->size == sizeof(_pktbuf_buf));
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return res;
 }
 
 bool gnrc_pktbuf_is_sane(void)
@@ -318,6 +395,8 @@ bool gnrc_pktbuf_is_sane(void)
      *  - forall ptr in _unused_t list: (ptr->next != NULL && ptr->size <= (ptr->next - ptr)) ||
      *                                  (ptr->next == NULL
      *                                  && ptr->size == (CONFIG_GNRC_PKTBUF_SIZE - pos_in_buf))
+     *    (with size classes, small chunks may follow the last section, so
+     *    only ptr->size <= (CONFIG_GNRC_PKTBUF_SIZE - pos_in_buf))
      */
 
     while (ptr) {
@@ -329,13 +408,27 @@ bool gnrc_pktbuf_is_sane(void)
             return false;
         }
         size_t pos_in_buf = (uint8_t *)ptr - &gnrc_pktbuf_static_buf[0];
+        size_t to_end = CONFIG_GNRC_PKTBUF_SIZE - pos_in_buf;
         if (((ptr->next == NULL) || (ptr->size > (size_t)((uint8_t *)(ptr->next) - (uint8_t *)ptr)))
-            && ((ptr->next != NULL) || (ptr->size != CONFIG_GNRC_PKTBUF_SIZE - pos_in_buf))) {
+            && ((ptr->next != NULL) ||
+                (IS_ACTIVE(CONFIG_GNRC_PKTBUF_SIZE_CLASSES) ? (ptr->size > to_end)
+                                                            : (ptr->size != to_end)))) {
             return false;
         }
         ptr = ptr->next;
     }
 
+#ifdef SIZE_CLASS_LISTS
+    for (unsigned i = 0; i < SIZE_CLASSES_NUMOF; i++) {
+        for (ptr = _classes[i]; ptr != NULL; ptr = ptr->next) {
+            if (!gnrc_pktbuf_contains(ptr) ||
+                !gnrc_pktbuf_contains((uint8_t *)ptr + ((i + 1) * sizeof(_unused_t)) - 1)) {
+                return false;
+            }
+        }
+    }
+#endif
+
     return true;
 }
 #endif
@@ -365,21 +458,40 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
     return pkt;
 }
 
-static void *_pktbuf_alloc(size_t size)
+/* allocates from the list of _first_unused: takes the first large enough
+ * section or, with size classes, the smallest one. Small chunks are cut from
+ * the end of the last large enough section instead, so they gather at the end
+ * of the packet buffer and do not split up the space for larger packets. */
+static void *_alloc_unused(size_t size)
 {
-    _unused_t *prev = NULL, *ptr = _first_unused;
-
-    size = _align(size);
-    while (ptr && (size > ptr->size)) {
-        prev = ptr;
-        ptr = ptr->next;
+    const bool classes = IS_ACTIVE(CONFIG_GNRC_PKTBUF_SIZE_CLASSES);
+    const bool small = classes && (size <= CONFIG_GNRC_PKTBUF_SIZE_CLASS_MAX);
+    _unused_t *prev = NULL, *ptr = NULL;
+    void *res = NULL;
+
+    for (_unused_t *p = NULL, *cur = _first_unused; cur != NULL;
+         p = cur, cur = cur->next) {
+        if (size > cur->size) {
+            continue;
+        }
+        if (small || (ptr == NULL) || (cur->size < ptr->size)) {
+            prev = p;
+            ptr = cur;
+            if (!classes || (cur->size == size)) {
+                break;
+            }
+        }
     }
     if (ptr == NULL) {
-        DEBUG("pktbuf: no space left in packet buffer\n");
         return NULL;
     }
+    if (small && ((ptr->size - size) >= sizeof(_unused_t))) {
+        /* ptr stays in the list with the remaining size */
+        ptr->size -= size;
+        res = ((uint8_t *)ptr) + ptr->size;
+    }
     /* _unused_t struct would fit => add new space at ptr */
-    if (sizeof(_unused_t) > (ptr->size - size)) {
+    else if (sizeof(_unused_t) > (ptr->size - size)) {
         if (prev == NULL) { /* ptr was _first_unused */
             _first_unused = ptr->next;
         }
@@ -406,13 +518,51 @@ static void *_pktbuf_alloc(size_t size)
         new->next = ptr->next;
         new->size = ptr->size - size;
     }
+    if (res == NULL) {
+        res = ptr;
+    }
 #ifdef DEVELHELP
-    uint16_t last_byte = (uint16_t)((((uint8_t *)ptr) + size) - &(gnrc_pktbuf_static_buf[0]));
+    uint16_t last_byte = (uint16_t)((((uint8_t *)res) + size) - &(gnrc_pktbuf_static_buf[0]));
     if (last_byte > max_byte_count) {
         max_byte_count = last_byte;
     }
 #endif
-    return (void *)ptr;
+    return res;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    void *res;
+
+    size = _align(size);
+#ifdef SIZE_CLASS_LISTS
+    if ((size <= CONFIG_GNRC_PKTBUF_SIZE_CLASS_MAX) &&
+        (_classes[_class(size)] != NULL)) {
+        res = _classes[_class(size)];
+        _classes[_class(size)] = _classes[_class(size)]->next;
+        _classes_len[_class(size)]--;
+        return res;
+    }
+#endif
+    res = _alloc_unused(size);
+    if ((res == NULL) && _flush_classes()) {
+        res = _alloc_unused(size);
+    }
+    if (res == NULL) {
+        DEBUG("pktbuf: no space left in packet buffer\n");
+#ifdef DEVELHELP
+        size_t free_bytes = 0;
+
+        for (_unused_t *ptr = _first_unused; ptr != NULL; ptr = ptr->next) {
+            free_bytes += ptr->size;
+        }
+        _alloc_failed++;
+        if (free_bytes >= size) {
+            _alloc_failed_frag++;
+        }
+#endif
+    }
+    return res;
 }
 
 static inline bool _too_small_hole(_unused_t *a, _unused_t *b)
@@ -429,14 +579,11 @@ static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
     return a;
 }
 
-void gnrc_pktbuf_free_internal(void *data, size_t size)
+static void _free_unused(void *data, size_t size)
 {
     size_t bytes_at_end;
     _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
 
-    if (!gnrc_pktbuf_contains(data)) {
-        return;
-    }
     while (ptr && (((void *)ptr) < data)) {
         prev = ptr;
         ptr = ptr->next;
@@ -466,4 +613,25 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
     }
 }
 
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    if (!gnrc_pktbuf_contains(data)) {
+        return;
+    }
+#ifdef SIZE_CLASS_LISTS
+    size = _align(size);
+    /* cached chunks are not merged with their neighbors, so only keep a few */
+    if ((size > 0) && (size <= CONFIG_GNRC_PKTBUF_SIZE_CLASS_MAX) &&
+        (_classes_len[_class(size)] < CONFIG_GNRC_PKTBUF_SIZE_CLASS_DEPTH)) {
+        _unused_t *chunk = data;
+
+        chunk->next = _classes[_class(size)];
+        _classes[_class(size)] = chunk;
+        _classes_len[_class(size)]++;
+        return;
+    }
+#endif
+    _free_unused(data, size);
+}
+
 /** @} */
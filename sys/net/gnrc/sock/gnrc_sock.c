@@ -196,8 +196,12 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+/* with @p async the TX sync snip calling @p cb is appended just before the
+ * packet is handed to the stack and the function returns without waiting for
+ * the transmission */
+static ssize_t _send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                     const sock_ip_ep_t *remote, uint8_t nh,
+                     gnrc_tx_sync_t *async, gnrc_tx_sync_cb_t cb, void *arg)
 {
     gnrc_pktsnip_t *pkt;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
@@ -216,7 +220,8 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     }
 
 #if IS_USED(MODULE_GNRC_TX_SYNC)
-    if (gnrc_tx_sync_append(payload, &tx_sync)) {
+    /* an asynchronous send appends its own TX sync snip below */
+    if ((async == NULL) && gnrc_tx_sync_append(payload, &tx_sync)) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
@@ -229,6 +234,7 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
             pkt = gnrc_ipv6_hdr_build(payload, (ipv6_addr_t *)&local->addr.ipv6,
                                       (ipv6_addr_t *)&remote->addr.ipv6);
             if (pkt == NULL) {
+                gnrc_pktbuf_release(payload);
                 return -ENOMEM;
             }
             if (payload->type == GNRC_NETTYPE_UNDEF) {
@@ -268,6 +274,25 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         netif_hdr->if_pid = iface;
         pkt = gnrc_pkt_prepend(pkt, netif);
     }
+    if (IS_USED(MODULE_GNRC_TX_SYNC) && (async != NULL)) {
+        /* cppcheck-suppress uninitvar
+         * (reason: pkt is initialized in AF_INET6 case above, otherwise
+         * function will return early) */
+        if (gnrc_tx_sync_append_cb(pkt, async, cb, arg)) {
+            gnrc_pktbuf_release(pkt);
+            return -ENOMEM;
+        }
+        if (!gnrc_netapi_dispatch_send(type, GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+            /* this should not happen, but just in case: errors are reported
+             * by the return value only */
+            async->cb = NULL;
+            gnrc_pktbuf_release(pkt);
+            return -EBADMSG;
+        }
+        /* no waiting for error reports either, they would arrive after
+         * returning */
+        return payload_len;
+    }
 #ifdef MODULE_GNRC_NETERR
     /* cppcheck-suppress uninitvar
      * (reason: pkt is initialized in AF_INET6 case above, otherwise function
@@ -322,4 +347,18 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     return payload_len;
 }
 
+ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                       const sock_ip_ep_t *remote, uint8_t nh)
+{
+    return _send(payload, local, remote, nh, NULL, NULL, NULL);
+}
+
+ssize_t gnrc_sock_send_async(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                             const sock_ip_ep_t *remote, uint8_t nh,
+                             gnrc_tx_sync_t *tx_sync, gnrc_tx_sync_cb_t cb,
+                             void *arg)
+{
+    return _send(payload, local, remote, nh, tx_sync, cb, arg);
+}
+
 /** @} */
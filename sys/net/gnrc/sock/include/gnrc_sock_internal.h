@@ -26,6 +26,7 @@
 #include "net/af.h"
 #include "net/gnrc.h"
 #include "net/gnrc/netreg.h"
+#include "net/gnrc/tx_sync.h"
 #include "net/iana/portrange.h"
 #include "net/sock/ip.h"
 
@@ -154,6 +155,19 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t time
  */
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh);
+
+/**
+ * @brief   Send a packet internally without waiting for the transmission
+ *
+ * @p cb is called with @p arg once the stack released the packet, unless an
+ * error is returned.
+ *
+ * @internal
+ */
+ssize_t gnrc_sock_send_async(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                             const sock_ip_ep_t *remote, uint8_t nh,
+                             gnrc_tx_sync_t *tx_sync, gnrc_tx_sync_cb_t cb,
+                             void *arg);
 /**
  * @}
  */
@@ -34,6 +34,10 @@
 #endif
 #include "net/sock/ip.h"
 #include "net/sock/udp.h"
+#ifdef MODULE_GNRC_SOCK_TCP
+#include "net/gnrc/tcp/tcb.h"
+#include "net/sock/tcp.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -136,6 +140,28 @@ struct sock_udp {
     uint16_t flags;                        /**< option flags */
 };
 
+#if defined(MODULE_GNRC_SOCK_TCP) || defined(DOXYGEN)
+/**
+ * @brief   TCP sock type
+ *
+ * @note    The TCB must stay the only member, so an array of sock objects
+ *          is an array of TCBs for @ref gnrc_tcp_listen().
+ * @internal
+ */
+struct sock_tcp {
+    gnrc_tcp_tcb_t tcb;                    /**< GNRC TCP connection */
+};
+
+/**
+ * @brief   TCP listening queue type
+ * @internal
+ */
+struct sock_tcp_queue {
+    gnrc_tcp_tcb_queue_t queue;            /**< GNRC TCP listening queue */
+    sock_tcp_ep_t local;                   /**< local end-point */
+};
+#endif
+
 #ifdef __cplusplus
 }
 #endif
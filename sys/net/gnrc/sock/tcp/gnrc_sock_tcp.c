@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       GNRC implementation of @ref net_sock_tcp
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "net/sock/tcp.h"
+#include "timex.h"
+
+#include "sock_types.h"
+
+static_assert(sizeof(sock_tcp_t) == sizeof(gnrc_tcp_tcb_t),
+              "sock_tcp_t arrays must be usable as TCB arrays");
+
+static int _ep_to_gnrc(gnrc_tcp_ep_t *out, const sock_tcp_ep_t *in)
+{
+#ifdef SOCK_HAS_IPV6
+    return gnrc_tcp_ep_init(out, in->family, in->addr.ipv6, sizeof(in->addr.ipv6),
+                            in->port, in->netif);
+#else
+    (void)out;
+    (void)in;
+    return -EAFNOSUPPORT;
+#endif
+}
+
+static void _ep_from_tcb(sock_tcp_ep_t *out, const gnrc_tcp_tcb_t *tcb, bool local)
+{
+    memset(out, 0, sizeof(sock_tcp_ep_t));
+    out->family = tcb->address_family;
+#if defined(MODULE_GNRC_IPV6) && defined(SOCK_HAS_IPV6)
+    memcpy(out->addr.ipv6, (local) ? tcb->local_addr : tcb->peer_addr,
+           sizeof(out->addr.ipv6));
+    out->netif = (tcb->ll_iface > 0) ? tcb->ll_iface : SOCK_ADDR_ANY_NETIF;
+#endif
+    out->port = (local) ? tcb->local_port : tcb->peer_port;
+}
+
+/* gnrc_tcp takes milliseconds, where zero means non-blocking */
+static uint32_t _timeout_ms(uint32_t timeout)
+{
+    return (timeout / US_PER_MS) + ((timeout % US_PER_MS) ? 1 : 0);
+}
+
+int sock_tcp_connect(sock_tcp_t *sock, const sock_tcp_ep_t *remote,
+                     uint16_t local_port, uint16_t flags)
+{
+    assert(sock);
+    assert(remote && (remote->port != 0));
+    gnrc_tcp_ep_t ep;
+
+    (void)flags;
+    if (_ep_to_gnrc(&ep, remote) < 0) {
+        return -EAFNOSUPPORT;
+    }
+    gnrc_tcp_tcb_init(&sock->tcb);
+    return gnrc_tcp_open(&sock->tcb, &ep, local_port);
+}
+
+int sock_tcp_listen(sock_tcp_queue_t *queue, const sock_tcp_ep_t *local,
+                    sock_tcp_t *queue_array, unsigned queue_len,
+                    uint16_t flags)
+{
+    assert(queue);
+    assert(local && (local->port != 0));
+    assert(queue_array && (queue_len != 0));
+    gnrc_tcp_ep_t ep;
+
+    (void)flags;
+    if (_ep_to_gnrc(&ep, local) < 0) {
+        return -EAFNOSUPPORT;
+    }
+    queue->queue = (gnrc_tcp_tcb_queue_t)GNRC_TCP_TCB_QUEUE_INIT;
+    memcpy(&queue->local, local, sizeof(sock_tcp_ep_t));
+    for (unsigned i = 0; i < queue_len; i++) {
+        gnrc_tcp_tcb_init(&queue_array[i].tcb);
+#ifdef SOCK_HAS_ASYNC
+        queue_array[i].tcb.queue = &queue->queue;
+#endif
+    }
+    return gnrc_tcp_listen(&queue->queue, &queue_array[0].tcb, queue_len, &ep);
+}
+
+#ifdef SOCK_HAS_ASYNC
+/* The TCP thread takes the callbacks and pending events under the FSM lock,
+ * so nothing is reported to @p tcb after this returns */
+static void _async_stop(gnrc_tcp_tcb_t *tcb, bool queue)
+{
+    mutex_lock(&tcb->fsm_lock);
+    tcb->async_cb = NULL;
+    tcb->async_flags = 0;
+    if (queue) {
+        tcb->queue = NULL;
+    }
+    mutex_unlock(&tcb->fsm_lock);
+}
+#endif
+
+void sock_tcp_disconnect(sock_tcp_t *sock)
+{
+    assert(sock);
+#ifdef SOCK_HAS_ASYNC
+    /* The connection is not reported to its owner anymore */
+    _async_stop(&sock->tcb, false);
+#endif
+    gnrc_tcp_close(&sock->tcb);
+}
+
+void sock_tcp_stop_listen(sock_tcp_queue_t *queue)
+{
+    assert(queue);
+#ifdef SOCK_HAS_ASYNC
+    /* Detach the TCBs from the queue first, they are closed below */
+    mutex_lock(&queue->queue.lock);
+    for (size_t i = 0; i < queue->queue.tcbs_len; i++) {
+        _async_stop(&queue->queue.tcbs[i], true);
+    }
+    queue->queue.async_cb = NULL;
+    mutex_unlock(&queue->queue.lock);
+#endif
+    gnrc_tcp_stop_listen(&queue->queue);
+}
+
+int sock_tcp_get_local(sock_tcp_t *sock, sock_tcp_ep_t *ep)
+{
+    assert(sock && ep);
+    if (sock->tcb.local_port == 0) {
+        return -EADDRNOTAVAIL;
+    }
+    _ep_from_tcb(ep, &sock->tcb, true);
+    return 0;
+}
+
+int sock_tcp_get_remote(sock_tcp_t *sock, sock_tcp_ep_t *ep)
+{
+    assert(sock && ep);
+    if (sock->tcb.peer_port == 0) {
+        return -ENOTCONN;
+    }
+    _ep_from_tcb(ep, &sock->tcb, false);
+    return 0;
+}
+
+int sock_tcp_queue_get_local(sock_tcp_queue_t *queue, sock_tcp_ep_t *ep)
+{
+    assert(queue && ep);
+    if (queue->queue.tcbs == NULL) {
+        return -EADDRNOTAVAIL;
+    }
+    memcpy(ep, &queue->local, sizeof(sock_tcp_ep_t));
+    return 0;
+}
+
+int sock_tcp_accept(sock_tcp_queue_t *queue, sock_tcp_t **sock,
+                    uint32_t timeout)
+{
+    assert(queue && sock);
+    gnrc_tcp_tcb_t *tcb;
+    int res;
+
+    if (queue->queue.tcbs == NULL) {
+        return -EINVAL;
+    }
+    do {
+        res = gnrc_tcp_accept(&queue->queue, &tcb, _timeout_ms(timeout));
+    } while ((res == -ETIMEDOUT) && (timeout == SOCK_NO_TIMEOUT));
+
+    if (res == 0) {
+        *sock = (sock_tcp_t *)tcb;
+    }
+    return res;
+}
+
+ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
+                      uint32_t timeout)
+{
+    assert(sock && data && (max_len > 0));
+    ssize_t res;
+
+    do {
+        res = gnrc_tcp_recv(&sock->tcb, data, max_len, _timeout_ms(timeout));
+    } while ((res == -ETIMEDOUT) && (timeout == SOCK_NO_TIMEOUT));
+    return res;
+}
+
+ssize_t sock_tcp_write(sock_tcp_t *sock, const void *data, size_t len)
+{
+    assert(sock);
+    assert((len == 0) || data);
+
+    if (len == 0) {
+        return 0;
+    }
+    return gnrc_tcp_send(&sock->tcb, data, len, 0);
+}
+
+#ifdef SOCK_HAS_ASYNC
+void sock_tcp_set_cb(sock_tcp_t *sock, sock_tcp_cb_t cb, void *arg)
+{
+    mutex_lock(&sock->tcb.fsm_lock);
+    sock->tcb.async_cb_arg = arg;
+    sock->tcb.async_cb = cb;
+    mutex_unlock(&sock->tcb.fsm_lock);
+}
+
+void sock_tcp_queue_set_cb(sock_tcp_queue_t *queue, sock_tcp_queue_cb_t cb,
+                           void *arg)
+{
+    queue->queue.async_cb_arg = arg;
+    queue->queue.async_cb = cb;
+}
+
+#ifdef SOCK_HAS_ASYNC_CTX
+sock_async_ctx_t *sock_tcp_get_async_ctx(sock_tcp_t *sock)
+{
+    return &sock->tcb.async_ctx;
+}
+
+sock_async_ctx_t *sock_tcp_queue_get_async_ctx(sock_tcp_queue_t *queue)
+{
+    return &queue->queue.async_ctx;
+}
+#endif  /* SOCK_HAS_ASYNC_CTX */
+#endif  /* SOCK_HAS_ASYNC */
+
+/** @} */
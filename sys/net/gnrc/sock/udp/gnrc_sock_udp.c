@@ -23,6 +23,7 @@
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
+#include "net/gnrc/sock_udp_zc.h"
 #include "net/gnrc/udp.h"
 #include "net/sock/udp.h"
 #include "net/udp.h"
@@ -278,39 +279,45 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
-                          const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+/* sends @p payload, without waiting for the transmission if @p tx_sync is
+ * given; releases @p payload on error */
+static ssize_t _send(sock_udp_t *sock, gnrc_pktsnip_t *payload,
+                     const sock_udp_ep_t *remote, gnrc_tx_sync_t *tx_sync,
+                     gnrc_tx_sync_cb_t cb, void *arg)
 {
-    (void)aux;
     int res;
-    gnrc_pktsnip_t *payload, *pkt;
+    gnrc_pktsnip_t *pkt;
     uint16_t src_port = 0, dst_port;
     sock_ip_ep_t local;
     sock_udp_ep_t remote_cpy;
     sock_ip_ep_t *rem;
 
     assert((sock != NULL) || (remote != NULL));
-    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
 
     if (remote != NULL) {
         if (remote->port == 0) {
-            return -EINVAL;
+            res = -EINVAL;
+            goto error;
         }
         else if (gnrc_ep_addr_any((const sock_ip_ep_t *)remote)) {
-            return -EINVAL;
+            res = -EINVAL;
+            goto error;
         }
         else if (gnrc_af_not_supported(remote->family)) {
-            return -EAFNOSUPPORT;
+            res = -EAFNOSUPPORT;
+            goto error;
         }
         else if ((sock != NULL) &&
                  (sock->local.netif != SOCK_ADDR_ANY_NETIF) &&
                  (remote->netif != SOCK_ADDR_ANY_NETIF) &&
                  (sock->local.netif != remote->netif)) {
-            return -EINVAL;
+            res = -EINVAL;
+            goto error;
         }
     }
     else if (sock->remote.family == AF_UNSPEC) {
-        return -ENOTCONN;
+        res = -ENOTCONN;
+        goto error;
     }
     /* cppcheck-suppress nullPointerRedundantCheck
      * (reason: compiler evaluates lazily so this isn't a redundundant check and
@@ -319,7 +326,8 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
         /* no sock or sock currently unbound */
         memset(&local, 0, sizeof(local));
         if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
-            return -EADDRINUSE;
+            res = -EADDRINUSE;
+            goto error;
         }
         /* cppcheck-suppress nullPointer
          * (reason: sock *can* be NULL at this place, cppcheck is weird here as
@@ -360,19 +368,22 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
         local.family = rem->family;
     }
     else if (local.family != rem->family) {
-        return -EINVAL;
-    }
-    /* generate payload and header snips */
-    payload = gnrc_pktbuf_add(NULL, (void *)data, len, GNRC_NETTYPE_UNDEF);
-    if (payload == NULL) {
-        return -ENOMEM;
+        res = -EINVAL;
+        goto error;
     }
+    /* generate header snip */
     pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
     if (pkt == NULL) {
-        gnrc_pktbuf_release(payload);
-        return -ENOMEM;
+        res = -ENOMEM;
+        goto error;
+    }
+    if (tx_sync != NULL) {
+        res = gnrc_sock_send_async(pkt, &local, rem, PROTNUM_UDP, tx_sync, cb,
+                                   arg);
+    }
+    else {
+        res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -383,8 +394,70 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
     }
 #endif  /* SOCK_HAS_ASYNC */
     return res;
+
+error:
+    gnrc_pktbuf_release(payload);
+    return res;
 }
 
+ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
+                          const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    (void)aux;
+    gnrc_pktsnip_t *payload;
+
+    assert((sock != NULL) || (remote != NULL));
+    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+
+    /* generate payload snip */
+    payload = gnrc_pktbuf_add(NULL, (void *)data, len, GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return -ENOMEM;
+    }
+    return _send(sock, payload, remote, NULL, NULL, NULL);
+}
+
+#if IS_USED(MODULE_GNRC_SOCK_UDP_ZC)
+ssize_t sock_udp_sendv_zc(sock_udp_t *sock, const iolist_t *snips,
+                          const sock_udp_ep_t *remote, sock_udp_zc_t *zc,
+                          gnrc_tx_sync_cb_t cb, void *arg)
+{
+    gnrc_pktsnip_t *payload = NULL, *last = NULL;
+
+    assert((sock != NULL) || (remote != NULL));
+    assert((zc != NULL) && (cb != NULL));
+
+    /* reference the chunks from descriptor-only snips, the static packet
+     * buffer does not free data outside of its buffer */
+    for (const iolist_t *iol = snips; iol != NULL; iol = iol->iol_next) {
+        gnrc_pktsnip_t *snip = gnrc_pktbuf_add(NULL, NULL, 0,
+                                               GNRC_NETTYPE_UNDEF);
+
+        if (snip == NULL) {
+            gnrc_pktbuf_release(payload);
+            return -ENOMEM;
+        }
+        snip->data = iol->iol_base;
+        snip->size = iol->iol_len;
+        if (last == NULL) {
+            payload = snip;
+        }
+        else {
+            last->next = snip;
+        }
+        last = snip;
+    }
+    if (payload == NULL) {
+        /* no payload at all */
+        payload = gnrc_pktbuf_add(NULL, NULL, 0, GNRC_NETTYPE_UNDEF);
+        if (payload == NULL) {
+            return -ENOMEM;
+        }
+    }
+    return _send(sock, payload, remote, &zc->tx_sync, cb, arg);
+}
+#endif
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
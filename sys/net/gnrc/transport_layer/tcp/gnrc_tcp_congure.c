@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/congure.h
+ * @}
+ */
+
+#include <string.h>
+#include "evtimer.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
+#include "include/gnrc_tcp_pkt.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_CUBIC)
+#define _CONGURE(tcb)   (&(tcb)->congure.super.super)
+#else
+#define _CONGURE(tcb)   (&(tcb)->congure.super)
+#endif
+
+/**
+ * @brief Get the CongURE driver of a TCB.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   The driver or NULL if the congestion control was not initialized yet.
+ */
+static inline const congure_snd_driver_t *_driver(gnrc_tcp_tcb_t *tcb)
+{
+    return _CONGURE(tcb)->driver;
+}
+
+/**
+ * @brief Reports the oldest entry of the retransmission queue via @p report.
+ *
+ * @param[in,out] tcb      TCB holding the connection information.
+ * @param[in]     report   Method of the driver to report the entry with.
+ */
+static void _report_head(gnrc_tcp_tcb_t *tcb,
+                         void (*report)(congure_snd_t *, congure_snd_msg_t *))
+{
+    congure_snd_msg_t msg = {
+        .send_time = tcb->pkt_retransmit_time[0],
+        .size = _gnrc_tcp_pkt_get_pay_len(tcb->pkt_retransmit[0]),
+        .resends = tcb->retries,
+    };
+
+    /* A single element circular list */
+    msg.super.next = &msg.super;
+    report(_CONGURE(tcb), &msg);
+}
+
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    unsigned mss = CONFIG_GNRC_TCP_MSS;
+
+    /* Messages are at most as large as both MSS */
+    if ((tcb->mss > 0) && (tcb->mss < mss)) {
+        mss = tcb->mss;
+    }
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_CUBIC)
+    congure_cubic_snd_setup(&tcb->congure, mss);
+#else
+    congure_reno_snd_setup(&tcb->congure, mss);
+#endif
+    _driver(tcb)->init(_CONGURE(tcb), tcb);
+    TCP_DEBUG_LEAVE;
+}
+
+uint32_t _gnrc_tcp_congure_get_wnd(const gnrc_tcp_tcb_t *tcb)
+{
+    return _CONGURE(tcb)->cwnd;
+}
+
+void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    tcb->pkt_retransmit_time[tcb->pkt_retransmit_len - 1] = evtimer_now_msec();
+    if ((_driver(tcb) != NULL) && (len > 0)) {
+        _driver(tcb)->report_msg_sent(_CONGURE(tcb), len);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb, uint8_t acked, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    /* The newest acknowledged entry triggered the acknowledgment */
+    congure_snd_msg_t msg = {
+        .send_time = tcb->pkt_retransmit_time[acked - 1],
+        .size = len,
+        .resends = tcb->retries,
+    };
+    congure_snd_ack_t ack = {
+        .recv_time = evtimer_now_msec(),
+        .id = tcb->snd_una,
+        .size = len,
+        .wnd = (tcb->snd_wnd < CONGURE_WND_SIZE_MAX) ? tcb->snd_wnd : CONGURE_WND_SIZE_MAX,
+    };
+
+    memmove(tcb->pkt_retransmit_time, &tcb->pkt_retransmit_time[acked],
+            tcb->pkt_retransmit_len * sizeof(tcb->pkt_retransmit_time[0]));
+
+    /* Segments carrying only SYN or FIN do not count */
+    if ((_driver(tcb) != NULL) && (len > 0)) {
+        _driver(tcb)->report_msg_acked(_CONGURE(tcb), &msg, &ack);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_congure_report_lost(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (_driver(tcb) != NULL) {
+        _report_head(tcb, _driver(tcb)->report_msgs_lost);
+    }
+    /* The entry is retransmitted now */
+    tcb->pkt_retransmit_time[0] = evtimer_now_msec();
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (_driver(tcb) != NULL) {
+        _report_head(tcb, _driver(tcb)->report_msgs_timeout);
+    }
+    /* The entry is retransmitted now */
+    tcb->pkt_retransmit_time[0] = evtimer_now_msec();
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_congure_report_discarded(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (_driver(tcb) != NULL) {
+        for (unsigned i = 0; i < tcb->pkt_retransmit_len; i++) {
+            size_t len = _gnrc_tcp_pkt_get_pay_len(tcb->pkt_retransmit[i]);
+
+            if (len > 0) {
+                _driver(tcb)->report_msg_discarded(_CONGURE(tcb), len);
+            }
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
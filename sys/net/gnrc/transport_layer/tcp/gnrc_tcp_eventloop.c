@@ -340,6 +340,14 @@ static void *_eventloop(__attribute__((unused)) void *arg)
                               FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
                 break;
 
+#if defined(MODULE_GNRC_SOCK_TCP) && defined(SOCK_HAS_ASYNC)
+            /* Asynchronous events of another thread: Report them from here */
+            case MSG_TYPE_ASYNC_EVENT:
+                TCP_DEBUG_INFO("Received MSG_TYPE_ASYNC_EVENT.");
+                _gnrc_tcp_fsm_async_report((gnrc_tcp_tcb_t *)msg.content.ptr);
+                break;
+#endif
+
             default:
                 TCP_DEBUG_ERROR("Received unexpected message.");
         }
@@ -368,6 +376,23 @@ void _gnrc_tcp_eventloop_unsched(evtimer_msg_event_t *event)
     TCP_DEBUG_LEAVE;
 }
 
+int _gnrc_tcp_eventloop_post(uint16_t type, void *context)
+{
+    TCP_DEBUG_ENTER;
+    msg_t msg;
+
+    msg.type = type;
+    msg.content.ptr = context;
+    int ret = msg_try_send(&msg, _tcp_eventloop_pid);
+    TCP_DEBUG_LEAVE;
+    return (ret == 1) ? 1 : 0;
+}
+
+bool _gnrc_tcp_eventloop_is_current(void)
+{
+    return thread_getpid() == _tcp_eventloop_pid;
+}
+
 int _gnrc_tcp_eventloop_init(void)
 {
     TCP_DEBUG_ENTER;
@@ -17,6 +17,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <utlist.h>
 #include <errno.h>
 #include "random.h"
@@ -25,6 +26,7 @@
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
@@ -92,15 +94,92 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->pkt_retransmit_len > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        if (IS_USED(MODULE_GNRC_TCP_CONGURE)) {
+            _gnrc_tcp_congure_report_discarded(tcb);
+        }
+        for (unsigned i = 0; i < tcb->pkt_retransmit_len; i++) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+        }
+        tcb->pkt_retransmit_len = 0;
     }
+    tcb->dup_acks = 0;
+    tcb->status &= ~STATUS_RTT_TIMED;
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Retransmits the oldest unacknowledged segment without waiting for
+ *        the retransmission timer.
+ *
+ * @param[in,out] tcb   TCB holding the retransmit queue.
+ */
+static void _fast_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[0];
+
+    if (IS_USED(MODULE_GNRC_TCP_CONGURE)) {
+        _gnrc_tcp_congure_report_lost(tcb);
+    }
+    /* Every send attempt consumes a user */
+    gnrc_pktbuf_hold(pkt, 1);
+    _gnrc_tcp_pkt_send(tcb, pkt, 0, true);
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Get the number of duplicate ACKs that trigger a fast retransmit.
+ *
+ * @note With SACK, fewer segments in flight than DUP_ACK_THRESHOLD + 1 lower
+ *       the threshold, because they can't cause enough duplicate ACKs
+ *       (Early Retransmit, see RFC 5827).
+ *
+ * @param[in] tcb   TCB holding the retransmit queue.
+ *
+ * @returns   Number of duplicate ACKs.
+ */
+static unsigned _dup_ack_threshold(const gnrc_tcp_tcb_t *tcb)
+{
+    if ((tcb->status & STATUS_SACK) && (tcb->pkt_retransmit_len > 1) &&
+        (tcb->pkt_retransmit_len <= DUP_ACK_THRESHOLD)) {
+        return tcb->pkt_retransmit_len - 1;
+    }
+    return DUP_ACK_THRESHOLD;
+}
+
+/**
+ * @brief Retransmits the oldest unacknowledged segment, if the peer selectively
+ *        acknowledged data following it and it was not retransmitted yet.
+ *
+ * @note This repairs every further hole after a partial acknowledgment right
+ *       away instead of waiting for the retransmission timer (see RFC 6675).
+ *
+ * @param[in,out] tcb   TCB holding the retransmit queue.
+ */
+static void _sack_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (!(tcb->status & STATUS_SACK) || (tcb->pkt_retransmit_len == 0) || (tcb->retries > 0)) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[0];
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    uint32_t end = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num) +
+                   _gnrc_tcp_pkt_get_seg_len(pkt);
+
+    if (LSS_32_BIT(end, tcb->snd_sack_high)) {
+        /* Every send attempt consumes a user */
+        gnrc_pktbuf_hold(pkt, 1);
+        _gnrc_tcp_pkt_send(tcb, pkt, 0, true);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -136,8 +215,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue and out-of-order segments */
             _clear_retransmit(tcb);
+            _gnrc_tcp_rcvbuf_ooo_clear(tcb);
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -225,6 +305,11 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
             }
+            /* Start congestion control once the connection is synchronized */
+            if (IS_USED(MODULE_GNRC_TCP_CONGURE) &&
+                (tcb->state == FSM_STATE_SYN_SENT || tcb->state == FSM_STATE_SYN_RCVD)) {
+                _gnrc_tcp_congure_init(tcb);
+            }
             tcb->status |= STATUS_NOTIFY_USER;
             break;
 
@@ -272,6 +357,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         tcb->iss = random_uint32();
         tcb->snd_nxt = tcb->iss;
         tcb->snd_una = tcb->iss;
+        tcb->snd_sack_high = tcb->iss;
 
         /* Transition FSM to SYN_SENT */
         ret = _transition_to(tcb, FSM_STATE_SYN_SENT);
@@ -296,6 +382,9 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 /**
  * @brief FSM Handling function for sending data.
  *
+ * @note Sends segments as long as the send window is open and the
+ *       retransmission queue has room for them.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
@@ -305,27 +394,46 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    while (sent < len && tcb->pkt_retransmit_len < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+        uint32_t wnd = tcb->snd_wnd;
+
+        /* Limit send window to congestion window */
+        if (IS_USED(MODULE_GNRC_TCP_CONGURE)) {
+            uint32_t cwnd = _gnrc_tcp_congure_get_wnd(tcb);
+            wnd = (wnd < cwnd) ? wnd : cwnd;
+        }
+        uint32_t wnd_end = tcb->snd_una + wnd;
+
+        /* Check if window is open */
+        if (!LSS_32_BIT(tcb->snd_nxt, wnd_end)) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
+        size_t payload = wnd_end - tcb->snd_nxt;
         payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
         payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
 
-        /* Calculate payload size for this segment */
+        /* Build and send segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                tcb->snd_nxt, tcb->rcv_nxt, (uint8_t *)buf + sent,
+                                payload) < 0) {
+            break;
+        }
+        if (_gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false) < 0) {
+            gnrc_pktbuf_release(out_pkt);
+            break;
+        }
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -349,6 +457,9 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
     size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
 
+    /* Copy kept data that did not fit into the receive buffer before */
+    _gnrc_tcp_rcvbuf_ooo_merge(tcb);
+
     /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size */
     if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
         tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
@@ -469,6 +580,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
 
+    /* The window of segments without SYN is scaled (see RFC 7323, section 2.3) */
+    if (!(ctl & MSK_SYN) && (tcb->status & STATUS_WND_SCALE)) {
+        seg_wnd <<= tcb->snd_wnd_scale;
+    }
+
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_IPV6);
@@ -560,6 +676,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->iss = random_uint32();
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
+            tcb->snd_sack_high = tcb->iss;
             tcb->snd_wnd = seg_wnd;
 
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
@@ -701,7 +818,20 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     tcb->snd_una = seg_ack;
+                    tcb->dup_acks = 0;
+                    if (LSS_32_BIT(tcb->snd_sack_high, seg_ack)) {
+                        tcb->snd_sack_high = seg_ack;
+                    }
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _sack_retransmit(tcb);
+                }
+                /* Duplicate ACK (see RFC 5681, section 2): Fast retransmit after threshold */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && !(ctl & MSK_FIN) &&
+                         seg_wnd == tcb->snd_wnd && tcb->pkt_retransmit_len > 0) {
+                    tcb->dup_acks += 1;
+                    if (tcb->dup_acks == _dup_ack_threshold(tcb)) {
+                        _fast_retransmit(tcb);
+                    }
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -726,25 +856,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -760,16 +890,15 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
-                /* Search for begin of payload */
-                snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
-
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
+                uint32_t rcv_nxt = tcb->rcv_nxt;
+
+                /* Add data to the receive buffer. Data behind a gap is kept
+                 * until the gap is filled, unless a FIN follows it. The FIN
+                 * is processed after its retransmission. */
+                if (LEQ_32_BIT(seg_seq, tcb->rcv_nxt) || !(ctl & MSK_FIN)) {
+                    _gnrc_tcp_rcvbuf_add(tcb, in_pkt, seg_seq, pay_len);
+                }
+                if (tcb->rcv_nxt != rcv_nxt) {
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
@@ -791,6 +920,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* FIN behind a gap: Acknowledge the data received so far, wait for retransmission */
+            if (LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+                _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                    tcb->rcv_nxt, NULL, 0);
+                _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -801,7 +938,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -845,9 +982,13 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit_len > 0) {
+        /* Retransmit the oldest unacknowledged segment */
+        if (IS_USED(MODULE_GNRC_TCP_CONGURE)) {
+            _gnrc_tcp_congure_report_timeout(tcb);
+        }
+        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -966,6 +1107,105 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
     return ret;
 }
 
+#if IS_USED(MODULE_GNRC_SOCK_TCP) && defined(SOCK_HAS_ASYNC)
+/**
+ * @brief TCB members asynchronous events are derived from.
+ */
+typedef struct {
+    uint32_t snd_una;   /**< Send unacknowledged */
+    uint32_t snd_wnd;   /**< Send window */
+    uint32_t rcv_nxt;   /**< Receive next */
+    uint8_t state;      /**< Connections state */
+    uint8_t status;     /**< A connections status flags */
+} _async_snapshot_t;
+
+/**
+ * @brief Derives the asynchronous events caused by an FSM call.
+ *
+ * @note Must be called from a context where the FSM is locked.
+ *       SOCK_ASYNC_CONN_RECV is reported to the listening queue of the TCB,
+ *       all other events to the TCB itself.
+ *
+ * @param[in]  tcb       TCB holding the connection information after the FSM call.
+ * @param[in]  old       Snapshot of the TCB taken before the FSM call.
+ *
+ * @returns   Flags of the events to report, zero if there are none.
+ */
+static sock_async_flags_t _async_event_get(const gnrc_tcp_tcb_t *tcb,
+                                           const _async_snapshot_t *old)
+{
+    uint8_t state = tcb->state;
+    sock_async_flags_t flags = 0;
+
+    /* Connections of a listening TCB belong to its queue until they were accepted */
+    if ((old->status & STATUS_LISTENING) && !(old->status & STATUS_ACCEPTED)) {
+        if ((state != old->state) && tcb->queue && tcb->queue->async_cb &&
+            (state == FSM_STATE_ESTABLISHED || state == FSM_STATE_CLOSE_WAIT)) {
+            flags = SOCK_ASYNC_CONN_RECV;
+        }
+        return flags;
+    }
+    if (tcb->async_cb == NULL) {
+        return flags;
+    }
+    if (state != old->state) {
+        if ((old->state == FSM_STATE_SYN_SENT) &&
+            (state == FSM_STATE_ESTABLISHED || state == FSM_STATE_CLOSE_WAIT)) {
+            flags |= SOCK_ASYNC_CONN_RDY;
+        }
+        if (state == FSM_STATE_CLOSE_WAIT || state == FSM_STATE_CLOSED ||
+            state == FSM_STATE_LISTEN) {
+            flags |= SOCK_ASYNC_CONN_FIN;
+        }
+    }
+    /* Data or FIN arrived: Data or end of stream is readable */
+    if ((tcb->rcv_nxt != old->rcv_nxt) &&
+        (old->state == FSM_STATE_ESTABLISHED || old->state == FSM_STATE_FIN_WAIT_1 ||
+         old->state == FSM_STATE_FIN_WAIT_2)) {
+        flags |= SOCK_ASYNC_MSG_RECV;
+    }
+    /* Data was acknowledged or the window moved: More data can be sent */
+    if (((tcb->snd_una != old->snd_una) || (tcb->snd_wnd != old->snd_wnd)) &&
+        (state == FSM_STATE_ESTABLISHED || state == FSM_STATE_CLOSE_WAIT)) {
+        flags |= SOCK_ASYNC_MSG_SENT;
+    }
+    return flags;
+}
+
+void _gnrc_tcp_fsm_async_report(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    sock_tcp_queue_cb_t queue_cb = NULL;
+    sock_tcp_queue_t *queue = NULL;
+    void *queue_arg = NULL;
+    sock_tcp_cb_t cb = NULL;
+    void *arg = NULL;
+
+    /* Take the pending events, callbacks may have been removed meanwhile */
+    mutex_lock(&(tcb->fsm_lock));
+    sock_async_flags_t flags = tcb->async_flags;
+    tcb->async_flags = 0;
+    if ((flags & SOCK_ASYNC_CONN_RECV) && tcb->queue) {
+        queue_cb = tcb->queue->async_cb;
+        queue = (sock_tcp_queue_t *)tcb->queue;
+        queue_arg = tcb->queue->async_cb_arg;
+    }
+    cb = tcb->async_cb;
+    arg = tcb->async_cb_arg;
+    mutex_unlock(&(tcb->fsm_lock));
+
+    /* Report unlocked, the callbacks may use the TCB */
+    if (queue_cb) {
+        queue_cb(queue, SOCK_ASYNC_CONN_RECV, queue_arg);
+    }
+    flags &= ~SOCK_ASYNC_CONN_RECV;
+    if (flags && cb) {
+        cb((sock_tcp_t *)tcb, flags, arg);
+    }
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
 int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
                   gnrc_pktsnip_t *in_pkt, void *buf, size_t len)
 {
@@ -973,6 +1213,17 @@ int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
     /* Lock FSM */
     mutex_lock(&(tcb->fsm_lock));
 
+#if IS_USED(MODULE_GNRC_SOCK_TCP) && defined(SOCK_HAS_ASYNC)
+    bool async_report = false;
+    _async_snapshot_t old = {
+        .snd_una = tcb->snd_una,
+        .snd_wnd = tcb->snd_wnd,
+        .rcv_nxt = tcb->rcv_nxt,
+        .state = tcb->state,
+        .status = tcb->status,
+    };
+#endif
+
     /* Call FSM */
     tcb->status &= ~STATUS_NOTIFY_USER;
     int32_t result = _fsm_unprotected(tcb, event, in_pkt, buf, len);
@@ -984,8 +1235,29 @@ int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         msg.content.ptr = tcb;
         mbox_try_put(tcb->mbox, &msg);
     }
+#if IS_USED(MODULE_GNRC_SOCK_TCP) && defined(SOCK_HAS_ASYNC)
+    if (tcb->status & STATUS_NOTIFY_USER) {
+        tcb->async_flags |= _async_event_get(tcb, &old);
+        async_report = (tcb->async_flags != 0);
+    }
+#endif
     /* Unlock FSM */
     mutex_unlock(&(tcb->fsm_lock));
+
+#if IS_USED(MODULE_GNRC_SOCK_TCP) && defined(SOCK_HAS_ASYNC)
+    /* Asynchronous events are reported from the TCP thread only: Other
+     * threads get here from gnrc_tcp calls that hold the function lock a
+     * callback might need. If posting fails, the events stay pending and
+     * are reported along with the next one. */
+    if (async_report) {
+        if (_gnrc_tcp_eventloop_is_current()) {
+            _gnrc_tcp_fsm_async_report(tcb);
+        }
+        else {
+            _gnrc_tcp_eventloop_post(MSG_TYPE_ASYNC_EVENT, tcb);
+        }
+    }
+#endif
     TCP_DEBUG_LEAVE;
     return result;
 }
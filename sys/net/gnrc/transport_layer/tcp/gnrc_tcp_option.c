@@ -22,11 +22,41 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/**
+ * @brief Processes the blocks of a SACK option.
+ *
+ * @param[in,out] tcb      TCB holding the connection information.
+ * @param[in]     option   SACK option to process.
+ */
+static void _process_sack(gnrc_tcp_tcb_t *tcb, const tcp_hdr_opt_t *option)
+{
+    unsigned blocks = (option->length - TCP_OPTION_LENGTH_MIN) / TCP_OPTION_LENGTH_SACK_BLOCK;
+
+    for (unsigned i = 0; i < blocks; i++) {
+        const uint8_t *val = &option->value[i * TCP_OPTION_LENGTH_SACK_BLOCK];
+        uint32_t right = ((uint32_t)val[4] << 24) | ((uint32_t)val[5] << 16) |
+                         ((uint32_t)val[6] << 8) | val[7];
+
+        /* Only the right edge of data that was sent is of interest */
+        if (LSS_32_BIT(tcb->snd_sack_high, right) && LEQ_32_BIT(right, tcb->snd_nxt)) {
+            tcb->snd_sack_high = right;
+        }
+    }
+}
+
 int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
 {
     TCP_DEBUG_ENTER;
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+
+    /* Window scale and SACK are negotiated with each SYN */
+    if (ctl & MSK_SYN) {
+        tcb->status &= ~(STATUS_WND_SCALE | STATUS_SACK);
+        tcb->snd_wnd_scale = 0;
+    }
+
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint8_t offset = GET_OFFSET(ctl);
     if (offset <= TCP_HDR_OFFSET_MIN) {
         TCP_DEBUG_LEAVE;
         return 0;
@@ -64,6 +94,47 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_WS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_WS) {
+                    TCP_DEBUG_ERROR("Invalid window scale option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("Window scale option found.");
+                if (ctl & MSK_SYN) {
+                    tcb->status |= STATUS_WND_SCALE;
+                    tcb->snd_wnd_scale = (option->value[0] < TCP_WS_SHIFT_MAX)
+                                       ? option->value[0] : TCP_WS_SHIFT_MAX;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK permitted option found.");
+                if (ctl & MSK_SYN) {
+                    tcb->status |= STATUS_SACK;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    ((option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK)) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK option found.");
+                if (tcb->status & STATUS_SACK) {
+                    _process_sack(tcb, option);
+                }
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
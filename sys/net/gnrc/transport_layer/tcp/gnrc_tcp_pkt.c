@@ -25,9 +25,11 @@
 #include "net/inet_csum.h"
 #include "net/gnrc.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
+#include "include/gnrc_tcp_rcvbuf.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -49,6 +51,39 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Keeps the RTO within its configured bounds.
+ *
+ * @param[in,out] tcb   TCB holding the RTO.
+ */
+static void _bound_rto(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+}
+
+/**
+ * @brief Calculates the RTO from the current round trip time estimation.
+ *
+ * @param[in,out] tcb   TCB holding the round trip time estimation.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* If there is no estimation yet: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+    _bound_rto(tcb);
+}
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -155,6 +190,10 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
+    uint32_t sack[2 * SACK_BLOCKS_MAX];
+    unsigned sack_blocks = 0;
+    bool ws = false;
+    bool sack_perm = false;
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -173,13 +212,34 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
     /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
     if (ctl & MSK_SYN) {
+        /* Add MSS option if SYN is sent */
         offset += 1;
+
+        /* Offer window scaling and SACK, or accept them if the peer offered them */
+        ws = !(ctl & MSK_ACK) || (tcb->status & STATUS_WND_SCALE);
+        sack_perm = !(ctl & MSK_ACK) || (tcb->status & STATUS_SACK);
+        offset += ws + sack_perm;
+
+        /* The window of a SYN is never scaled */
+        tcp_hdr.window = byteorder_htons((tcb->rcv_wnd < UINT16_MAX) ? tcb->rcv_wnd : UINT16_MAX);
+    }
+    else {
+        uint32_t wnd = tcb->rcv_wnd;
+
+        if (tcb->status & STATUS_WND_SCALE) {
+            wnd >>= _gnrc_tcp_option_get_rcv_wnd_scale();
+        }
+        tcp_hdr.window = byteorder_htons((wnd < UINT16_MAX) ? wnd : UINT16_MAX);
+
+        /* Add SACK option if segments behind a gap were received */
+        if ((ctl & MSK_ACK) && !(ctl & MSK_RST) && (tcb->status & STATUS_SACK)) {
+            sack_blocks = _gnrc_tcp_rcvbuf_ooo_get_sack(tcb, sack, SACK_BLOCKS_MAX);
+            offset += (sack_blocks > 0) ? 1 + 2 * sack_blocks : 0;
+        }
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
@@ -217,9 +277,38 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            /* Add window scale option, if negotiated */
+            if (ws) {
+                network_uint32_t ws_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_ws(_gnrc_tcp_option_get_rcv_wnd_scale()));
+
+                memcpy(opt_ptr, &ws_option, sizeof(ws_option));
+                opt_ptr += sizeof(ws_option);
+            }
+            /* Add SACK permitted option, if negotiated */
+            if (sack_perm) {
+                network_uint32_t sack_perm_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack_perm());
+
+                memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                opt_ptr += sizeof(sack_perm_option);
+            }
+            /* Add SACK option, if there are blocks to report */
+            if (sack_blocks > 0) {
+                network_uint32_t sack_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack(sack_blocks));
+
+                memcpy(opt_ptr, &sack_option, sizeof(sack_option));
+                opt_ptr += sizeof(sack_option);
+                for (unsigned i = 0; i < 2 * sack_blocks; i++) {
+                    network_uint32_t edge = byteorder_htonl(sack[i]);
+
+                    memcpy(opt_ptr, &edge, sizeof(edge));
+                    opt_ptr += sizeof(edge);
+                }
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
-            /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
     }
@@ -287,12 +376,18 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
-        tcb->retries = 0;
+        /* Time one segment at a time (see RFC 6298, section 3) */
+        if ((seq_con > 0) && !(tcb->status & STATUS_RTT_TIMED)) {
+            tcb->status |= STATUS_RTT_TIMED;
+            tcb->rtt_start = evtimer_now_msec();
+            tcb->rtt_seq = tcb->snd_nxt + seq_con;
+        }
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
     }
     else {
         tcb->retries += 1;
+        /* Karns Algorithm: Acknowledgments of retransmitted segments are ambiguous */
+        tcb->status &= ~STATUS_RTT_TIMED;
     }
 
     /* Pass packet down the network stack */
@@ -390,13 +485,6 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
-        TCP_DEBUG_LEAVE;
-        return -ENOMEM;
-    }
-
     /* Extract control bits and segment length */
     snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
     ctl = byteorder_ntohs(((tcp_hdr_t *) snp->data)->off_ctl);
@@ -408,22 +496,35 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
-    /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+        /* Check if retransmit queue is full */
+        if (tcb->pkt_retransmit_len >= ARRAY_SIZE(tcb->pkt_retransmit)) {
+            TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
         }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+
+        /* Append pkt and increase users: every send attempt consumes a user */
+        tcb->pkt_retransmit[tcb->pkt_retransmit_len++] = pkt;
+        gnrc_pktbuf_hold(pkt, 1);
+        if (IS_USED(MODULE_GNRC_TCP_CONGURE)) {
+            _gnrc_tcp_congure_report_sent(tcb, len);
+        }
+
+        /* The timer is already running for the oldest unacknowledged segment */
+        if (tcb->pkt_retransmit_len > 1) {
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
+        /* Keep a backed off rto until a new sample is taken (RFC 6298, 5.7) */
+        if (tcb->rto == RTO_UNINITIALIZED) {
+            _calc_rto(tcb);
         }
     }
     else {
+        /* pkt is the oldest segment in the queue, increase users for this attempt */
+        gnrc_pktbuf_hold(pkt, 1);
+
         /* If this is a retransmission: Double the rto (Timer Backoff) */
         tcb->rto *= 2;
 
@@ -433,17 +534,11 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
             tcb->srtt = RTO_UNINITIALIZED;
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
-    }
-
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+        _bound_rto(tcb);
     }
 
     /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
     _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
                               MSG_TYPE_RETRANSMISSION, tcb);
     TCP_DEBUG_LEAVE;
@@ -453,35 +548,49 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    uint8_t acked = 0;
+    size_t acked_len = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit_len == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
+    /* Release all segments covered by the cumulative acknowledgment */
+    while (acked < tcb->pkt_retransmit_len) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[acked];
+        gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+        tcp_hdr_t *hdr = (tcp_hdr_t *) snp->data;
+        uint32_t seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(pkt) - 1;
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
-
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        acked_len += _gnrc_tcp_pkt_get_pay_len(pkt);
+        gnrc_pktbuf_release(pkt);
+        acked++;
+    }
+    if (acked == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    tcb->pkt_retransmit_len -= acked;
+    memmove(tcb->pkt_retransmit, &tcb->pkt_retransmit[acked],
+            tcb->pkt_retransmit_len * sizeof(tcb->pkt_retransmit[0]));
+    if (IS_USED(MODULE_GNRC_TCP_CONGURE)) {
+        _gnrc_tcp_congure_report_acked(tcb, acked, acked_len);
+    }
 
-        /* Measure round trip time */
+    /* Measure round trip time if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_TIMED) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_TIMED;
+
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -494,8 +603,22 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
                 tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
                 tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
             }
+            /* Only a new sample replaces a backed off rto (RFC 6298, 5.7) */
+            _calc_rto(tcb);
         }
     }
+
+    /* New data was acknowledged: Restart timer for the remaining segments (RFC 6298, 5.3),
+     * without a new sample the (backed off) rto is kept (Karns Algorithm) */
+    tcb->retries = 0;
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    if (tcb->pkt_retransmit_len > 0) {
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
+    }
+
+    /* Notify user: Retransmit queue has room for new segments */
+    tcb->status |= STATUS_NOTIFY_USER;
     TCP_DEBUG_LEAVE;
     return 0;
 }
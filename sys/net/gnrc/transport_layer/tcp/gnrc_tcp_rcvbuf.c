@@ -17,9 +17,14 @@
  */
 #include <errno.h>
 #include <mutex.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+#include "net/gnrc.h"
+#include "net/tcp.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_rcvbuf.h"
 
 #define ENABLE_DEBUG 0
@@ -124,3 +129,233 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+/**
+ * @brief Get the sequence number of a kept out-of-order segment.
+ *
+ * @param[in] pkt   Kept segment.
+ *
+ * @returns   Sequence number of @p pkt.
+ */
+static uint32_t _ooo_seq(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+
+    return byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+}
+
+/**
+ * @brief Get the sequence number following the payload of a kept out-of-order segment.
+ *
+ * @param[in] pkt   Kept segment.
+ *
+ * @returns   Sequence number following the payload of @p pkt.
+ */
+static uint32_t _ooo_end(gnrc_pktsnip_t *pkt)
+{
+    return _ooo_seq(pkt) + _gnrc_tcp_pkt_get_pay_len(pkt);
+}
+
+/**
+ * @brief Release a kept out-of-order segment.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order segments.
+ * @param[in]     pos   Position of the segment in tcb->rcv_ooo.
+ */
+static void _ooo_remove(gnrc_tcp_tcb_t *tcb, unsigned pos)
+{
+    gnrc_pktbuf_release(tcb->rcv_ooo[pos]);
+    tcb->rcv_ooo_len -= 1;
+    memmove(&tcb->rcv_ooo[pos], &tcb->rcv_ooo[pos + 1],
+            (tcb->rcv_ooo_len - pos) * sizeof(tcb->rcv_ooo[0]));
+}
+
+/**
+ * @brief Copy the payload of a segment into the receive buffer and advance
+ *        tcb->rcv_nxt accordingly.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     pkt    Segment to copy the payload of.
+ * @param[in]     skip   Number of leading payload bytes that were already received.
+ */
+static void _copy(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t skip)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UNDEF);
+
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        if (skip < snp->size) {
+            size_t len = snp->size - skip;
+            size_t added = ringbuffer_add(&(tcb->rcv_buf), (char *)snp->data + skip, len);
+
+            tcb->rcv_nxt += added;
+            /* Stop if the receive buffer is full */
+            if (added < len) {
+                break;
+            }
+            skip = 0;
+        }
+        else {
+            skip -= snp->size;
+        }
+        snp = snp->next;
+    }
+}
+
+/**
+ * @brief Keep a segment that was received behind a gap in the sequence space.
+ *
+ * @param[in,out] tcb       TCB holding the out-of-order segments.
+ * @param[in]     pkt       Received segment, it is held if it is kept.
+ * @param[in]     seq       Sequence number of @p pkt.
+ * @param[in]     pay_len   Payload length of @p pkt.
+ *
+ * @returns   Zero on success.
+ *            -EEXIST if a kept segment holds all data of @p pkt.
+ *            -ENOMEM if all entries are used by segments preceding @p pkt.
+ */
+static int _ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seq,
+                    uint32_t pay_len)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t end = seq + pay_len;
+    unsigned pos = 0;
+
+    /* Drop pkt, if a kept segment holds all of its data */
+    for (unsigned i = 0; i < tcb->rcv_ooo_len; i++) {
+        if (LEQ_32_BIT(_ooo_seq(tcb->rcv_ooo[i]), seq) &&
+            LEQ_32_BIT(end, _ooo_end(tcb->rcv_ooo[i]))) {
+            TCP_DEBUG_INFO("Segment was already received.");
+            TCP_DEBUG_LEAVE;
+            return -EEXIST;
+        }
+    }
+    /* Release kept segments pkt holds all data of. Partial overlaps are
+     * kept, they are resolved while merging. */
+    while (pos < tcb->rcv_ooo_len) {
+        if (LEQ_32_BIT(seq, _ooo_seq(tcb->rcv_ooo[pos])) &&
+            LEQ_32_BIT(_ooo_end(tcb->rcv_ooo[pos]), end)) {
+            _ooo_remove(tcb, pos);
+        }
+        else {
+            pos++;
+        }
+    }
+    /* Find the first entry following pkt */
+    pos = 0;
+    while ((pos < tcb->rcv_ooo_len) && LEQ_32_BIT(_ooo_seq(tcb->rcv_ooo[pos]), seq)) {
+        pos++;
+    }
+    /* If all entries are used: Drop the last one, it is needed last */
+    if (tcb->rcv_ooo_len == ARRAY_SIZE(tcb->rcv_ooo)) {
+        if (pos == tcb->rcv_ooo_len) {
+            TCP_DEBUG_ERROR("-ENOMEM: Out-of-order segments are full.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
+        }
+        _ooo_remove(tcb, tcb->rcv_ooo_len - 1);
+    }
+    memmove(&tcb->rcv_ooo[pos + 1], &tcb->rcv_ooo[pos],
+            (tcb->rcv_ooo_len - pos) * sizeof(tcb->rcv_ooo[0]));
+    tcb->rcv_ooo[pos] = pkt;
+    tcb->rcv_ooo_len += 1;
+    tcb->rcv_ooo_last = seq;
+    gnrc_pktbuf_hold(pkt, 1);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+void _gnrc_tcp_rcvbuf_ooo_merge(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    while ((tcb->rcv_ooo_len > 0) && LEQ_32_BIT(_ooo_seq(tcb->rcv_ooo[0]), tcb->rcv_nxt)) {
+        uint32_t end = _ooo_end(tcb->rcv_ooo[0]);
+
+        if (LSS_32_BIT(tcb->rcv_nxt, end)) {
+            _copy(tcb, tcb->rcv_ooo[0], tcb->rcv_nxt - _ooo_seq(tcb->rcv_ooo[0]));
+
+            /* Keep the rest of the segment, if the receive buffer is full */
+            if (LSS_32_BIT(tcb->rcv_nxt, end)) {
+                break;
+            }
+        }
+        _ooo_remove(tcb, 0);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+int _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seq,
+                         uint32_t pay_len)
+{
+    TCP_DEBUG_ENTER;
+    /* Keep data behind a gap until the gap is filled */
+    if (LSS_32_BIT(tcb->rcv_nxt, seq)) {
+        int ret = _ooo_add(tcb, pkt, seq, pay_len);
+
+        TCP_DEBUG_LEAVE;
+        return ret;
+    }
+    /* Copy data that was not received before, then data that followed the gap */
+    if (LSS_32_BIT(tcb->rcv_nxt, seq + pay_len)) {
+        _copy(tcb, pkt, tcb->rcv_nxt - seq);
+    }
+    _gnrc_tcp_rcvbuf_ooo_merge(tcb);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+void _gnrc_tcp_rcvbuf_ooo_clear(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    while (tcb->rcv_ooo_len > 0) {
+        _ooo_remove(tcb, 0);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+unsigned _gnrc_tcp_rcvbuf_ooo_get_sack(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks,
+                                       unsigned max)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t edges[2 * CONFIG_GNRC_TCP_RCV_OOO_SIZE];
+    unsigned num = 0;
+    unsigned last = 0;
+    unsigned ret = 0;
+
+    /* Join adjacent and overlapping segments into blocks */
+    for (unsigned i = 0; i < tcb->rcv_ooo_len; i++) {
+        uint32_t seq = _ooo_seq(tcb->rcv_ooo[i]);
+        uint32_t end = _ooo_end(tcb->rcv_ooo[i]);
+        bool is_last = (seq == tcb->rcv_ooo_last);
+
+        /* Only data above rcv_nxt may be reported (see RFC 2018, section 4) */
+        if (LEQ_32_BIT(end, tcb->rcv_nxt)) {
+            continue;
+        }
+        if (LSS_32_BIT(seq, tcb->rcv_nxt)) {
+            seq = tcb->rcv_nxt;
+        }
+        if ((num > 0) && LEQ_32_BIT(seq, edges[2 * num - 1])) {
+            if (LSS_32_BIT(edges[2 * num - 1], end)) {
+                edges[2 * num - 1] = end;
+            }
+        }
+        else {
+            edges[2 * num] = seq;
+            edges[2 * num + 1] = end;
+            num++;
+        }
+        if (is_last) {
+            last = num - 1;
+        }
+    }
+    /* The block holding the segment received last comes first, the others follow */
+    for (unsigned i = 0; (i < num) && (ret < max); i++) {
+        unsigned block = (i == 0) ? last : ((i <= last) ? i - 1 : i);
+
+        blocks[2 * ret] = edges[2 * block];
+        blocks[2 * ret + 1] = edges[2 * block + 1];
+        ret++;
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
@@ -47,6 +47,9 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2)
 #define STATUS_ACCEPTED       (1 << 3)
 #define STATUS_LOCKED         (1 << 4)
+#define STATUS_RTT_TIMED      (1 << 5)
+#define STATUS_WND_SCALE      (1 << 6)
+#define STATUS_SACK           (1 << 7)
 /** @} */
 
 /**
@@ -86,8 +89,21 @@ extern "C" {
 #define MSG_TYPE_RETRANSMISSION     (GNRC_NETAPI_MSG_TYPE_ACK + 104)
 #define MSG_TYPE_TIMEWAIT           (GNRC_NETAPI_MSG_TYPE_ACK + 105)
 #define MSG_TYPE_NOTIFY_USER        (GNRC_NETAPI_MSG_TYPE_ACK + 106)
+#define MSG_TYPE_ASYNC_EVENT        (GNRC_NETAPI_MSG_TYPE_ACK + 107)
 /** @} */
 
+/**
+ * @brief Number of duplicate ACKs triggering a fast retransmit (see RFC 5681).
+ */
+#define DUP_ACK_THRESHOLD (3U)
+
+/**
+ * @brief Maximum number of blocks in a SACK option.
+ *
+ * Four blocks fill the option space of a segment without other options.
+ */
+#define SACK_BLOCKS_MAX (4U)
+
 /**
  * @brief Define for marking that time measurement is uninitialized.
  */
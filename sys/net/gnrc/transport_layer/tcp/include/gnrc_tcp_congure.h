@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Declarations for congestion control via CongURE.
+ *
+ * All sizes reported to the CongURE driver are payload sizes in bytes, all
+ * timestamps are in milliseconds.
+ */
+
+#ifndef GNRC_TCP_CONGURE_H
+#define GNRC_TCP_CONGURE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes the congestion control of a synchronized connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the congestion window.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of bytes that may be unacknowledged at a time.
+ */
+uint32_t _gnrc_tcp_congure_get_wnd(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Reports the newest entry of the retransmission queue as sent.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     len   Payload size of the newest entry.
+ */
+void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, size_t len);
+
+/**
+ * @brief Reports the oldest entries of the retransmission queue as acknowledged.
+ *
+ * @pre The acknowledged entries were already removed from tcb->pkt_retransmit.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     acked   Number of acknowledged entries.
+ * @param[in]     len     Payload size of all acknowledged entries.
+ */
+void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb, uint8_t acked, size_t len);
+
+/**
+ * @brief Reports the oldest entry of the retransmission queue as lost
+ *        before it is retransmitted.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_report_lost(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Reports a retransmission timeout for the oldest entry of the
+ *        retransmission queue before it is retransmitted.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Reports all entries of the retransmission queue as discarded.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_report_discarded(gnrc_tcp_tcb_t *tcb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CONGURE_H */
+/** @} */
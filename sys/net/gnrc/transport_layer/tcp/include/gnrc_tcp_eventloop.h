@@ -20,6 +20,7 @@
 #ifndef GNRC_TCP_EVENTLOOP_H
 #define GNRC_TCP_EVENTLOOP_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "evtimer_msg.h"
@@ -58,6 +59,25 @@ void _gnrc_tcp_eventloop_sched(evtimer_msg_event_t *event, uint32_t offset,
  */
 void _gnrc_tcp_eventloop_unsched(evtimer_msg_event_t *event);
 
+/**
+ * @brief   Post message to event loop without blocking
+ *
+ * @param[in] type      Type of the message
+ * @param[in] context   Context of the message
+ *
+ * @retval  1 if the message was posted
+ * @retval  0 if the message queue of the event loop is full
+ */
+int _gnrc_tcp_eventloop_post(uint16_t type, void *context);
+
+/**
+ * @brief   Check if the calling thread is the event loop
+ *
+ * @retval  true if called from the event loop
+ * @retval  false otherwise
+ */
+bool _gnrc_tcp_eventloop_is_current(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -97,6 +97,17 @@ void _gnrc_tcp_fsm_set_mbox(gnrc_tcp_tcb_t *tcb, mbox_t *mbox);
  */
 _gnrc_tcp_fsm_state_t _gnrc_tcp_fsm_get_state(gnrc_tcp_tcb_t *tcb);
 
+#if defined(MODULE_GNRC_SOCK_TCP) && defined(SOCK_HAS_ASYNC)
+/**
+ * @brief Report the pending asynchronous events of a TCB to its callbacks.
+ *
+ * @note Must only be called from the TCP thread.
+ *
+ * @param[in,out] tcb   TCB holding the pending events.
+ */
+void _gnrc_tcp_fsm_async_report(gnrc_tcp_tcb_t *tcb);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
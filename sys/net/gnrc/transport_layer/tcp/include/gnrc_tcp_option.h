@@ -42,6 +42,62 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the window scale option, preceded by a NOP.
+ *
+ * @param[in] shift   Shift count that should be set.
+ *
+ * @returns   Window scale option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_ws(uint8_t shift)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_WS << 16) |
+            ((uint32_t) TCP_OPTION_LENGTH_WS << 8) | shift);
+}
+
+/**
+ * @brief Helper function to build the SACK permitted option, preceded by two NOPs.
+ *
+ * @returns   SACK permitted option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) | TCP_OPTION_LENGTH_SACK_PERM);
+}
+
+/**
+ * @brief Helper function to build the header of a SACK option, preceded by two NOPs.
+ *
+ * @param[in] blocks   Number of blocks following the option header.
+ *
+ * @returns   SACK option header value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack(uint8_t blocks)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK << 8) |
+            (TCP_OPTION_LENGTH_MIN + blocks * TCP_OPTION_LENGTH_SACK_BLOCK));
+}
+
+/**
+ * @brief Get the shift count to announce in the window scale option.
+ *
+ * @returns   Smallest shift count that allows to announce the whole receive buffer.
+ */
+static inline uint8_t _gnrc_tcp_option_get_rcv_wnd_scale(void)
+{
+    uint8_t shift = 0;
+
+    while (((GNRC_TCP_RCV_BUF_SIZE >> shift) > UINT16_MAX) && (shift < TCP_WS_SHIFT_MAX)) {
+        shift++;
+    }
+    return shift;
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -111,9 +111,13 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
+ * New packets are appended to the retransmission queue. The retransmission
+ * timer covers the oldest packet in the queue.
+ *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
- * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
+ * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit
+ *                             of the oldest packet in the queue.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
@@ -123,7 +127,9 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
+ *
+ * Removes all packets covered by the cumulative acknowledgment @p ack.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -48,6 +48,58 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Add the payload of a received segment to the receive buffer.
+ *
+ * Data behind a gap in the sequence space is kept in the packet buffer and
+ * copied into the receive buffer once the gap is filled. tcb->rcv_nxt is
+ * advanced over all data copied into the receive buffer.
+ *
+ * @param[in,out] tcb       TCB holding the receive buffer.
+ * @param[in]     pkt       Received segment, it is held if it is kept.
+ * @param[in]     seq       Sequence number of @p pkt.
+ * @param[in]     pay_len   Payload length of @p pkt.
+ *
+ * @returns   Zero on success.
+ *            -EEXIST if @p pkt is behind a gap and a kept segment holds all of its data.
+ *            -ENOMEM if @p pkt is behind a gap and all entries are used by
+ *            segments preceding it.
+ */
+int _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seq,
+                         uint32_t pay_len);
+
+/**
+ * @brief Copy kept segments that are in order into the receive buffer.
+ *
+ * The part of a segment that does not fit into the receive buffer stays
+ * kept, so this has to be called again after data was read from the
+ * receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order segments.
+ */
+void _gnrc_tcp_rcvbuf_ooo_merge(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Release all kept out-of-order segments.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order segments.
+ */
+void _gnrc_tcp_rcvbuf_ooo_clear(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the blocks of contiguous out-of-order data (see RFC 2018, section 4).
+ *
+ * The block holding the segment received last comes first.
+ *
+ * @param[in]  tcb      TCB holding the out-of-order segments.
+ * @param[out] blocks   Left and right edge of each block.
+ * @param[in]  max      Maximum number of blocks to store in @p blocks.
+ *
+ * @returns   Number of blocks stored in @p blocks.
+ */
+unsigned _gnrc_tcp_rcvbuf_ooo_get_sack(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks,
+                                       unsigned max);
+
 #ifdef __cplusplus
 }
 #endif
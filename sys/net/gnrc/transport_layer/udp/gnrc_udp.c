@@ -18,6 +18,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <errno.h>
 
@@ -29,7 +30,9 @@
 #include "net/gnrc/udp.h"
 #include "net/gnrc.h"
 #include "net/gnrc/icmpv6/error.h"
+#include "net/gnrc/netif/internal.h"
 #include "net/inet_csum.h"
+#include "net/protnum.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -95,6 +98,28 @@ static uint16_t _calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr,
     }
 }
 
+/* checks if the receiving device already verified the checksum: the device
+ * only checks single frames with the UDP header directly following the IPv6
+ * header */
+static bool _csum_valid(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *ipv6)
+{
+    gnrc_pktsnip_t *netif_hdr = gnrc_pktsnip_search_type(pkt,
+                                                         GNRC_NETTYPE_NETIF);
+    gnrc_netif_t *netif;
+
+    if (netif_hdr == NULL) {
+        /* looped back by the node itself */
+        return false;
+    }
+    if ((((gnrc_netif_hdr_t *)netif_hdr->data)->flags &
+         GNRC_NETIF_HDR_FLAGS_REASSEMBLED) ||
+        (((ipv6_hdr_t *)ipv6->data)->nh != PROTNUM_UDP)) {
+        return false;
+    }
+    netif = gnrc_netif_hdr_get_netif(netif_hdr->data);
+    return (netif != NULL) && gnrc_netif_rx_csum_valid(netif);
+}
+
 static void _receive(gnrc_pktsnip_t *pkt)
 {
     gnrc_pktsnip_t *udp, *ipv6;
@@ -142,7 +167,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
         gnrc_pktbuf_release(pkt);
         return;
     }
-    if (_calc_csum(udp, ipv6, pkt) != 0xFFFF) {
+    if (!_csum_valid(pkt, ipv6) && (_calc_csum(udp, ipv6, pkt) != 0xFFFF)) {
         DEBUG("udp: received packet with invalid checksum, dropping it\n");
         gnrc_pktbuf_release(pkt);
         return;
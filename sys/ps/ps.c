@@ -26,6 +26,7 @@
 
 #ifdef MODULE_SCHEDSTATISTICS
 #include "schedstatistics.h"
+#include "sched_edf.h"
 #include "xtimer.h"
 #endif
 
@@ -53,6 +54,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime  | switches  | runtime_usec "
+#ifdef MODULE_SCHED_EDF
+           "| missed "
+#endif
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -119,6 +123,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u  | %10"PRIu32" "
+#ifdef MODULE_SCHED_EDF
+                   "| %6u "
+#endif
 #endif
                    "\n",
                    p->pid,
@@ -132,6 +139,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches, xtimer_usec_from_ticks(xtimer_ticks)
+#ifdef MODULE_SCHED_EDF
+                   , thread_missed_deadlines(i)
+#endif
 #endif
                   );
         }
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_edf
+ * @{
+ *
+ * @file
+ * @brief       Earliest deadline first scheduling class implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+
+#include "irq.h"
+#include "sched_edf.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+typedef struct {
+    ztimer_t timer;         /**< release or deadline timer of the thread */
+    uint32_t release;       /**< next periodic release */
+    uint32_t period;        /**< period of thread_periodic_release() */
+    unsigned missed;        /**< number of missed deadlines */
+} _edf_t;
+
+static _edf_t _edf[KERNEL_PID_LAST + 1];
+
+static void _deadline_cb(void *arg)
+{
+    kernel_pid_t pid = (kernel_pid_t)(intptr_t)arg;
+
+    DEBUG("sched_edf: thread %" PRIkernel_pid " missed its deadline\n", pid);
+    _edf[pid].missed++;
+}
+
+/* arms the deadline timer of @p pid, the deadline is missed if it already
+ * passed
+ * @pre IRQs are disabled */
+static void _arm_deadline(kernel_pid_t pid, uint32_t now, uint32_t deadline)
+{
+    ztimer_t *timer = &_edf[pid].timer;
+
+    timer->callback = _deadline_cb;
+    timer->arg = (void *)(intptr_t)pid;
+    if ((int32_t)(deadline - now) > 0) {
+        ztimer_set(ZTIMER_USEC, timer, deadline - now);
+    }
+    else {
+        _deadline_cb(timer->arg);
+    }
+}
+
+static void _release_cb(void *arg)
+{
+    kernel_pid_t pid = (kernel_pid_t)(intptr_t)arg;
+    thread_t *thread = thread_get(pid);
+    _edf_t *edf = &_edf[pid];
+    uint32_t deadline = edf->release + edf->period;
+
+    if (thread == NULL) {
+        return;
+    }
+    /* the deadline is set before the thread gets runnable, so it preempts
+     * threads of its priority with a later or no deadline right away */
+    sched_set_deadline(thread, deadline);
+    _arm_deadline(pid, ztimer_now(ZTIMER_USEC), deadline);
+    thread_wakeup(pid);
+}
+
+int thread_set_deadline(kernel_pid_t pid, uint32_t deadline)
+{
+    thread_t *thread = thread_get(pid);
+
+    if (thread == NULL) {
+        return -EINVAL;
+    }
+
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    _arm_deadline(pid, now, now + deadline);
+    irq_restore(state);
+
+    sched_set_deadline(thread, now + deadline);
+    return 0;
+}
+
+int thread_clear_deadline(kernel_pid_t pid)
+{
+    thread_t *thread = thread_get(pid);
+
+    if (thread == NULL) {
+        return -EINVAL;
+    }
+
+    ztimer_remove(ZTIMER_USEC, &_edf[pid].timer);
+    sched_clear_deadline(thread);
+    return 0;
+}
+
+void thread_periodic_release(uint32_t *last_release, uint32_t period)
+{
+    thread_t *me = thread_get_active();
+    kernel_pid_t pid = me->pid;
+    _edf_t *edf = &_edf[pid];
+
+    assert(!irq_is_in());
+
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    /* the job is done */
+    ztimer_remove(ZTIMER_USEC, &edf->timer);
+    sched_clear_deadline(me);
+
+    *last_release += period;
+    if ((int32_t)(*last_release - now) <= 0) {
+        /* overrun: the next job is released already */
+        DEBUG("sched_edf: thread %" PRIkernel_pid " overran its period\n",
+              pid);
+        _arm_deadline(pid, now, *last_release + period);
+        irq_restore(state);
+        sched_set_deadline(me, *last_release + period);
+        return;
+    }
+
+    edf->release = *last_release;
+    edf->period = period;
+    edf->timer.callback = _release_cb;
+    edf->timer.arg = (void *)(intptr_t)pid;
+    ztimer_set(ZTIMER_USEC, &edf->timer, *last_release - now);
+    /* woken up by _release_cb() */
+    sched_set_status(me, STATUS_SLEEPING);
+    irq_restore(state);
+    thread_yield_higher();
+}
+
+unsigned thread_missed_deadlines(kernel_pid_t pid)
+{
+    if (!pid_is_valid(pid)) {
+        return 0;
+    }
+    return _edf[pid].missed;
+}
+
+void sched_exit_callback(kernel_pid_t pid)
+{
+    ztimer_remove(ZTIMER_USEC, &_edf[pid].timer);
+}
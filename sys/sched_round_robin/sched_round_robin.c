@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_round_robin
+ * @{
+ *
+ * @file
+ * @brief       Round robin time slicing implementation
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "clist.h"
+#include "irq.h"
+#include "sched.h"
+#include "sched_round_robin.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static void _slice_expired(void *arg);
+
+static ztimer_t _timer = { .callback = _slice_expired };
+/* thread the time slice is currently tracked for */
+static kernel_pid_t _rr_pid = KERNEL_PID_UNDEF;
+static bool _disabled;
+
+static void _slice_expired(void *arg)
+{
+    (void)arg;
+    thread_t *active = thread_get_active();
+
+    if ((active != NULL) && (active->pid == _rr_pid)
+        && (active->status >= STATUS_ON_RUNQUEUE)) {
+        DEBUG("sched_rr: time slice of %" PRIkernel_pid " expired\n",
+              active->pid);
+        sched_runq_advance(active->priority);
+        /* re-armed for the next thread when it gets scheduled */
+        _rr_pid = KERNEL_PID_UNDEF;
+        sched_context_switch_request = 1;
+    }
+}
+
+static inline int _runq_has_peers(uint8_t prio)
+{
+    clist_node_t *last = sched_runqueues[prio].next;
+
+    return (last != NULL) && (last->next != last);
+}
+
+void sched_runq_callback(uint8_t prio)
+{
+    thread_t *active = thread_get_active();
+
+    /* only the runqueue of the running thread is of interest */
+    if (_disabled || (active == NULL) || (active->priority != prio)
+        || (prio == THREAD_PRIORITY_IDLE)) {
+        return;
+    }
+
+    if (!_runq_has_peers(prio)) {
+        if (_rr_pid != KERNEL_PID_UNDEF) {
+            ztimer_remove(ZTIMER_USEC, &_timer);
+            _rr_pid = KERNEL_PID_UNDEF;
+        }
+        return;
+    }
+
+    /* keep a running slice when peers get added, start a new one when
+     * another thread got scheduled */
+    if (_rr_pid != active->pid) {
+        _rr_pid = active->pid;
+        ztimer_set(ZTIMER_USEC, &_timer, CONFIG_SCHED_RR_QUANTUM_US);
+    }
+}
+
+void sched_round_robin_enable(bool enable)
+{
+    unsigned state = irq_disable();
+
+    _disabled = !enable;
+    if (_rr_pid != KERNEL_PID_UNDEF) {
+        ztimer_remove(ZTIMER_USEC, &_timer);
+        _rr_pid = KERNEL_PID_UNDEF;
+    }
+    /* start a slice right away if the running thread has peers */
+    if (enable && (thread_get_active() != NULL)) {
+        sched_runq_callback(thread_get_active()->priority);
+    }
+    irq_restore(state);
+}
@@ -181,6 +181,29 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
 }
 #endif /* MODULE_NETSTATS */
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+static void _netif_fq_stats(netif_t *iface)
+{
+    netstats_fq_t *stats;
+
+    if (netif_get_opt(iface, NETOPT_STATS, NETSTATS_PKTQ_FQ, &stats,
+                      sizeof(&stats)) < 0) {
+        return;
+    }
+    puts("          Send queue flows");
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS; i++) {
+        printf("            %2u: queued %u (max %u)  sent %u/%u  bytes %u  "
+               "dropped %u\n", i,
+               (unsigned)stats[i].backlog,
+               (unsigned)stats[i].backlog_max,
+               (unsigned)stats[i].dequeued,
+               (unsigned)stats[i].enqueued,
+               (unsigned)stats[i].dequeued_bytes,
+               (unsigned)stats[i].dropped);
+    }
+}
+#endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) */
+
 static void _link_usage(char *cmd_name)
 {
     printf("usage: %s <if_id> [up|down]\n", cmd_name);
@@ -912,6 +935,9 @@ static void _netif_list(netif_t *iface)
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    _netif_fq_stats(iface);
 #endif
     puts("");
 }
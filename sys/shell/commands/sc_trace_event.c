@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command for the kernel event tracer
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "trace_event.h"
+
+int _trace_event_handler(int argc, char **argv)
+{
+    if (argc != 2) {
+        goto usage;
+    }
+
+    if (!strcmp(argv[1], "dump")) {
+        trace_event_dump();
+    }
+    else if (!strcmp(argv[1], "start")) {
+        trace_event_start();
+    }
+    else if (!strcmp(argv[1], "stop")) {
+        trace_event_stop();
+    }
+    else if (!strcmp(argv[1], "reset")) {
+        trace_event_reset();
+    }
+    else {
+        goto usage;
+    }
+
+    return 0;
+
+usage:
+    printf("usage: %s {dump|start|stop|reset}\n", argv[0]);
+    return 1;
+}
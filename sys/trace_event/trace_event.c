@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_trace_event
+ * @{
+ *
+ * @file
+ * @brief       Kernel event tracer implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "periph/timer.h"
+#include "thread.h"
+#include "trace_event.h"
+#include "ztimer/config.h"
+
+static_assert(!(CONFIG_TRACE_EVENT_BUFSIZE & (CONFIG_TRACE_EVENT_BUFSIZE - 1)),
+              "CONFIG_TRACE_EVENT_BUFSIZE must be a power of two");
+
+static trace_event_t _buf[CONFIG_TRACE_EVENT_BUFSIZE];
+/* total number of events recorded since the last reset */
+static unsigned _pos;
+/* the timer is not initialized before auto init, so recording is off until
+ * then */
+static bool _enabled;
+
+void trace_event_record(trace_event_type_t type, kernel_pid_t pid,
+                        uint32_t arg)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+    trace_event_t *e = &_buf[_pos++ & (CONFIG_TRACE_EVENT_BUFSIZE - 1)];
+
+    /* no ztimer_now(): this runs within sched_run() with IRQs disabled */
+    e->time = timer_read(CONFIG_ZTIMER_USEC_DEV);
+    e->type = type;
+    e->flags = irq_is_in() ? TRACE_EVENT_FLAG_ISR : 0;
+    e->pid = pid;
+    e->arg = arg;
+    irq_restore(state);
+}
+
+void sched_trace_callback(sched_trace_event_t event, kernel_pid_t pid,
+                          uint32_t arg)
+{
+    trace_event_record((trace_event_type_t)event, pid, arg);
+}
+
+void trace_event_start(void)
+{
+    _enabled = true;
+    /* let the decoder know which thread is running */
+    trace_event_record(TRACE_EVENT_SCHED_SWITCH, thread_getpid(),
+                       (uint16_t)KERNEL_PID_UNDEF);
+}
+
+void trace_event_stop(void)
+{
+    _enabled = false;
+}
+
+void trace_event_reset(void)
+{
+    unsigned state = irq_disable();
+
+    _pos = 0;
+    irq_restore(state);
+}
+
+void trace_event_dump(void)
+{
+    bool enabled = _enabled;
+
+    _enabled = false;
+
+    unsigned n = (_pos > CONFIG_TRACE_EVENT_BUFSIZE)
+               ? CONFIG_TRACE_EVENT_BUFSIZE : _pos;
+
+    printf("trace_event: version=%u events=%u lost=%u isr_pid=%u "
+           "freq=%" PRIu32 " width=%u\n",
+           TRACE_EVENT_VERSION, n, _pos - n, (unsigned)KERNEL_PID_ISR,
+           (uint32_t)CONFIG_ZTIMER_USEC_BASE_FREQ,
+           (unsigned)CONFIG_ZTIMER_USEC_WIDTH);
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (thread_get(pid)) {
+            const char *name = thread_getname(pid);
+            printf("trace_event: thread %" PRIkernel_pid " %s\n", pid,
+                   name ? name : "-");
+        }
+    }
+
+    for (unsigned i = _pos - n; i != _pos; i++) {
+        const trace_event_t *e = &_buf[i & (CONFIG_TRACE_EVENT_BUFSIZE - 1)];
+        printf("trace_event: %08" PRIx32 " %02x %02x %04x %08" PRIx32 "\n",
+               e->time, e->type, e->flags, (uint16_t)e->pid, e->arg);
+    }
+
+    puts("trace_event: end");
+
+    _enabled = enabled;
+}
+
+void auto_init_trace_event(void)
+{
+    trace_event_start();
+}
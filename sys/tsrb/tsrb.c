@@ -17,6 +17,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "irq.h"
 #include "tsrb.h"
 
@@ -30,6 +32,12 @@ static uint8_t _pop(tsrb_t *rb)
     return rb->buf[rb->reads++ & (rb->size - 1)];
 }
 
+/* number of bytes from the position @p idx till the end of the buffer */
+static unsigned _till_end(const tsrb_t *rb, unsigned idx)
+{
+    return rb->size - (idx & (rb->size - 1));
+}
+
 int tsrb_get_one(tsrb_t *rb)
 {
     int retval = -1;
@@ -43,26 +51,34 @@ int tsrb_get_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
+    unsigned avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    /* copy in at most two segments: till the end of the buffer, then the
+     * wrapped around part from the start */
+    size_t first = _till_end(rb, rb->reads);
+    if (first > n) {
+        first = n;
+    }
+    memcpy(dst, &rb->buf[rb->reads & (rb->size - 1)], first);
+    memcpy(dst + first, rb->buf, n - first);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
+    unsigned avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -79,12 +95,60 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    unsigned space = rb->size - (rb->writes - rb->reads);
+    if (n > space) {
+        n = space;
+    }
+    size_t first = _till_end(rb, rb->writes);
+    if (first > n) {
+        first = n;
+    }
+    memcpy(&rb->buf[rb->writes & (rb->size - 1)], src, first);
+    memcpy(rb->buf, src + first, n - first);
+    rb->writes += n;
+    irq_restore(irq_state);
+    return n;
+}
+
+size_t tsrb_get_write_span(tsrb_t *rb, uint8_t **dst)
+{
+    unsigned irq_state = irq_disable();
+    size_t len = rb->size - (rb->writes - rb->reads);
+    size_t till_end = _till_end(rb, rb->writes);
+    if (len > till_end) {
+        len = till_end;
+    }
+    *dst = &rb->buf[rb->writes & (rb->size - 1)];
+    irq_restore(irq_state);
+    return len;
+}
+
+void tsrb_commit(tsrb_t *rb, size_t n)
+{
+    unsigned irq_state = irq_disable();
+    assert(n <= rb->size - (rb->writes - rb->reads));
+    rb->writes += n;
+    irq_restore(irq_state);
+}
+
+size_t tsrb_peek_read_span(tsrb_t *rb, const uint8_t **src)
+{
+    unsigned irq_state = irq_disable();
+    size_t len = rb->writes - rb->reads;
+    size_t till_end = _till_end(rb, rb->reads);
+    if (len > till_end) {
+        len = till_end;
     }
+    *src = &rb->buf[rb->reads & (rb->size - 1)];
+    irq_restore(irq_state);
+    return len;
+}
+
+void tsrb_consume(tsrb_t *rb, size_t n)
+{
+    unsigned irq_state = irq_disable();
+    assert(n <= rb->writes - rb->reads);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
 }
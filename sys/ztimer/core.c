@@ -23,11 +23,15 @@
  * @}
  */
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <inttypes.h>
 
 #include "kernel_defines.h"
 #include "irq.h"
+#if MODULE_ZTIMER_HEAP
+#include "bitarithm.h"
+#endif
 #ifdef MODULE_PM_LAYERED
 #include "pm_layered.h"
 #endif
@@ -38,6 +42,10 @@
 
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static uint32_t _head_offset(const ztimer_clock_t *clock);
+static void _set_base_to_head(ztimer_clock_t *clock);
+static uint32_t _coalesce(const ztimer_clock_t *clock, uint32_t val,
+                          uint32_t limit);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 
@@ -50,12 +58,17 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_HEAP
+    /* only the root of the heap has no parent */
+    return (t->base.parent || &t->base == clock->list.next);
+#else
     if (!clock->list.next) {
         return 0;
     }
     else {
         return (t->base.next || &t->base == clock->last);
     }
+#endif
 }
 
 unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer)
@@ -81,10 +94,12 @@ void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     irq_restore(state);
 }
 
-void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+static void _ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                        uint32_t slack)
 {
-    DEBUG("ztimer_set(): %p: set %p at %" PRIu32 " offset %" PRIu32 "\n",
-          (void *)clock, (void *)timer, clock->ops->now(clock), val);
+    DEBUG("ztimer_set(): %p: set %p at %" PRIu32 " offset %" PRIu32
+          " slack %" PRIu32 "\n",
+          (void *)clock, (void *)timer, clock->ops->now(clock), val, slack);
 
     unsigned state = irq_disable();
 
@@ -101,6 +116,19 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
         val = 0;
     }
 
+    if (slack && clock->list.next) {
+        uint32_t limit = (slack > UINT32_MAX - val) ? UINT32_MAX : val + slack;
+        uint32_t target = _coalesce(clock, val, limit);
+        if (target != val) {
+            DEBUG("ztimer_set(): %p: coalescing %p to %" PRIu32 "\n",
+                  (void *)clock, (void *)timer, target);
+            val = target;
+#if MODULE_ZTIMER_STATS
+            clock->stats.coalesced++;
+#endif
+        }
+    }
+
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
     if (clock->list.next == &timer->base) {
@@ -116,6 +144,18 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     irq_restore(state);
 }
 
+void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+{
+    _ztimer_set(clock, timer, val, 0);
+}
+
+void ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                           uint32_t val, uint32_t slack)
+{
+    _ztimer_set(clock, timer, val, slack);
+}
+
+#if !MODULE_ZTIMER_HEAP
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     uint32_t delta_sum = 0;
@@ -155,6 +195,24 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 }
 
+/* find the earliest target within [val, limit], relative to the list base */
+static uint32_t _coalesce(const ztimer_clock_t *clock, uint32_t val,
+                          uint32_t limit)
+{
+    uint32_t delta_sum = 0;
+
+    for (const ztimer_base_t *entry = clock->list.next; entry;
+         entry = entry->next) {
+        delta_sum += entry->offset;
+        if (delta_sum >= val) {
+            return (delta_sum <= limit) ? delta_sum : val;
+        }
+    }
+
+    return val;
+}
+#endif /* !MODULE_ZTIMER_HEAP */
+
 static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
 {
     if (a < b) {
@@ -186,6 +244,7 @@ ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
 }
 #endif /* MODULE_ZTIMER_EXTEND */
 
+#if !MODULE_ZTIMER_HEAP
 void ztimer_update_head_offset(ztimer_clock_t *clock)
 {
     uint32_t old_base = clock->list.offset;
@@ -292,13 +351,297 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     }
 }
 
+static uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+    return clock->list.next->offset;
+}
+
+static void _set_base_to_head(ztimer_clock_t *clock)
+{
+    clock->list.offset += clock->list.next->offset;
+    clock->list.next->offset = 0;
+}
+#else /* !MODULE_ZTIMER_HEAP */
+/*
+ * The timers of a clock form a binary min-heap of nodes linked by pointers
+ * (next: left child, right: right child, parent), rooted at clock->list.next.
+ * Each node stores its absolute target time in offset. Nodes are ordered by
+ * their distance from the clock's base time (clock->list.offset), which is
+ * never ahead of the earliest target (see ztimer_update_head_offset()), so
+ * that 32bit wrap-arounds don't affect the order.
+ *
+ * The position of the n-th node (counting from 1, in level order) is encoded
+ * in the binary representation of n: starting below the most significant bit,
+ * each bit selects the left (0) or right (1) child.
+ */
+static inline uint32_t _key(const ztimer_clock_t *clock,
+                            const ztimer_base_t *entry)
+{
+    return entry->offset - clock->list.offset;
+}
+
+static ztimer_base_t *_heap_node(const ztimer_clock_t *clock, unsigned pos)
+{
+    ztimer_base_t *node = clock->list.next;
+
+    for (unsigned bit = bitarithm_msb(pos); bit-- > 0;) {
+        node = (pos & (1U << bit)) ? node->right : node->next;
+    }
+    return node;
+}
+
+static void _heap_replace_child(ztimer_clock_t *clock, ztimer_base_t *parent,
+                                ztimer_base_t *old, ztimer_base_t *new)
+{
+    if (!parent) {
+        clock->list.next = new;
+    }
+    else if (parent->next == old) {
+        parent->next = new;
+    }
+    else {
+        parent->right = new;
+    }
+}
+
+/* swap @p entry with its parent */
+static void _heap_swap_up(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t *parent = entry->parent;
+    ztimer_base_t *left = entry->next;
+    ztimer_base_t *right = entry->right;
+
+    _heap_replace_child(clock, parent->parent, parent, entry);
+    entry->parent = parent->parent;
+
+    if (parent->next == entry) {
+        entry->next = parent;
+        entry->right = parent->right;
+        if (entry->right) {
+            entry->right->parent = entry;
+        }
+    }
+    else {
+        entry->right = parent;
+        entry->next = parent->next;
+        if (entry->next) {
+            entry->next->parent = entry;
+        }
+    }
+    parent->parent = entry;
+
+    parent->next = left;
+    if (left) {
+        left->parent = parent;
+    }
+    parent->right = right;
+    if (right) {
+        right->parent = parent;
+    }
+}
+
+static void _heap_sift_up(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    uint32_t key = _key(clock, entry);
+
+    while (entry->parent && (key < _key(clock, entry->parent))) {
+        _heap_swap_up(clock, entry);
+    }
+}
+
+static void _heap_sift_down(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    uint32_t key = _key(clock, entry);
+
+    while (entry->next) {
+        ztimer_base_t *child = entry->next;
+        if (entry->right && (_key(clock, entry->right) < _key(clock, child))) {
+            child = entry->right;
+        }
+        if (_key(clock, child) >= key) {
+            break;
+        }
+        _heap_swap_up(clock, child);
+    }
+}
+
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+#ifdef MODULE_PM_LAYERED
+    /* First timer on the clock's heap */
+    if (clock->list.next == NULL &&
+        clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_block(clock->block_pm_mode);
+    }
+#endif
+
+    /* the base time is now(), see ztimer_set() */
+    entry->offset += clock->list.offset;
+    entry->next = NULL;
+    entry->right = NULL;
+
+    unsigned pos = ++clock->heap_size;
+
+    if (pos == 1) {
+        entry->parent = NULL;
+        clock->list.next = entry;
+    }
+    else {
+        ztimer_base_t *parent = _heap_node(clock, pos >> 1);
+        if (pos & 1) {
+            parent->right = entry;
+        }
+        else {
+            parent->next = entry;
+        }
+        entry->parent = parent;
+        _heap_sift_up(clock, entry);
+    }
+
+    DEBUG("_add_entry_to_list() %p target %" PRIu32 "\n", (void *)entry,
+          entry->offset);
+}
+
+static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    DEBUG("_del_entry_from_list()\n");
+
+    assert(_is_set(clock, (ztimer_t *)entry));
+
+    /* detach the last node of the heap and move it into the place of entry */
+    ztimer_base_t *last = _heap_node(clock, clock->heap_size--);
+
+    _heap_replace_child(clock, last->parent, last, NULL);
+
+    if (last != entry) {
+        last->parent = entry->parent;
+        last->next = entry->next;
+        last->right = entry->right;
+        _heap_replace_child(clock, entry->parent, entry, last);
+        if (last->next) {
+            last->next->parent = last;
+        }
+        if (last->right) {
+            last->right->parent = last;
+        }
+
+        if (last->parent && (_key(clock, last) < _key(clock, last->parent))) {
+            _heap_sift_up(clock, last);
+        }
+        else {
+            _heap_sift_down(clock, last);
+        }
+    }
+
+    /* reset the entry's parent so _is_set() considers it unset */
+    entry->parent = NULL;
+    entry->next = NULL;
+    entry->right = NULL;
+
+#ifdef MODULE_PM_LAYERED
+    /* The last timer just got removed from the clock's heap */
+    if (clock->list.next == NULL &&
+        clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_unblock(clock->block_pm_mode);
+    }
+#endif
+}
+
+/* move all entries due within @p diff ticks after @p base to @p now */
+static void _heap_clamp(ztimer_base_t *entry, uint32_t base, uint32_t diff,
+                        uint32_t now)
+{
+    /* due entries form a subtree at the top of the heap */
+    while (entry && (entry->offset - base <= diff)) {
+        entry->offset = now;
+        _heap_clamp(entry->next, base, diff, now);
+        entry = entry->right;
+    }
+}
+
+void ztimer_update_head_offset(ztimer_clock_t *clock)
+{
+    uint32_t old_base = clock->list.offset;
+    uint32_t now = ztimer_now(clock);
+    uint32_t diff = now - old_base;
+
+    DEBUG(
+        "clock %p: ztimer_update_head_offset(): diff=%" PRIu32 " head %p\n",
+        (void *)clock, diff, (void *)clock->list.next);
+
+    /* Timers that are due get their target moved to now, so that the base
+     * time never passes a target. Moving them all to the same time keeps the
+     * heap ordered. */
+    if (diff) {
+        _heap_clamp(clock->list.next, old_base, diff, now);
+    }
+
+    clock->list.offset = now;
+}
+
+static ztimer_t *_now_next(ztimer_clock_t *clock)
+{
+    ztimer_base_t *entry = clock->list.next;
+
+    if (entry && (_key(clock, entry) == 0)) {
+        _del_entry_from_list(clock, entry);
+        return (ztimer_t *)entry;
+    }
+    else {
+        return NULL;
+    }
+}
+
+static uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+    return _key(clock, clock->list.next);
+}
+
+static void _set_base_to_head(ztimer_clock_t *clock)
+{
+    clock->list.offset = clock->list.next->offset;
+}
+
+/* find the smallest key within [val, *best] in the subtree of @p entry */
+static bool _heap_coalesce(const ztimer_clock_t *clock,
+                           const ztimer_base_t *entry, uint32_t val,
+                           uint32_t *best)
+{
+    bool found = false;
+
+    while (entry) {
+        uint32_t key = _key(clock, entry);
+        if (key > *best) {
+            break;
+        }
+        if (key >= val) {
+            /* no key in the subtree of entry is smaller */
+            *best = key;
+            return true;
+        }
+        found |= _heap_coalesce(clock, entry->next, val, best);
+        entry = entry->right;
+    }
+
+    return found;
+}
+
+static uint32_t _coalesce(const ztimer_clock_t *clock, uint32_t val,
+                          uint32_t limit)
+{
+    uint32_t best = limit;
+
+    return _heap_coalesce(clock, clock->list.next, val, &best) ? best : val;
+}
+#endif /* MODULE_ZTIMER_HEAP */
+
 static void _ztimer_update(ztimer_clock_t *clock)
 {
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
         if (clock->list.next) {
             clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
+                            _min_u32(_head_offset(clock),
                                      clock->max_value >> 1));
         }
         else {
@@ -310,7 +653,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     }
     else {
         if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+            clock->ops->set(clock, _head_offset(clock));
         }
         else {
             if (IS_USED(MODULE_ZTIMER_NOW64)) {
@@ -338,7 +681,7 @@ void ztimer_handler(ztimer_clock_t *clock)
         uint32_t now = ztimer_now(clock);
 
         if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+            uint32_t target = clock->list.offset + _head_offset(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -362,10 +705,14 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 #endif
 
-    clock->list.offset += clock->list.next->offset;
-    clock->list.next->offset = 0;
+    _set_base_to_head(clock);
 
     ztimer_t *entry = _now_next(clock);
+#if MODULE_ZTIMER_STATS
+    if (entry) {
+        clock->stats.wakeups++;
+    }
+#endif
     while (entry) {
         DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
               (void *)entry, (void *)entry->base.next, clock->ops->now(clock));
@@ -377,6 +724,12 @@ void ztimer_handler(ztimer_clock_t *clock)
             ztimer_update_head_offset(clock);
             entry = _now_next(clock);
         }
+#if MODULE_ZTIMER_STATS
+        if (entry) {
+            /* triggers within the same interrupt */
+            clock->stats.avoided++;
+        }
+#endif
     }
 
     _ztimer_update(clock);
@@ -390,6 +743,25 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 }
 
+#if MODULE_ZTIMER_STATS
+void ztimer_stats_get(const ztimer_clock_t *clock, ztimer_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    *stats = clock->stats;
+    irq_restore(state);
+}
+
+void ztimer_stats_reset(ztimer_clock_t *clock)
+{
+    unsigned state = irq_disable();
+
+    clock->stats = (ztimer_stats_t){ 0 };
+    irq_restore(state);
+}
+#endif
+
+#if !MODULE_ZTIMER_HEAP
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
     const ztimer_base_t *entry = &clock->list;
@@ -405,3 +777,15 @@ static void _ztimer_print(const ztimer_clock_t *clock)
     } while ((entry = entry->next));
     puts("");
 }
+#else /* !MODULE_ZTIMER_HEAP */
+static void _ztimer_print(const ztimer_clock_t *clock)
+{
+    printf("base %" PRIu32 ":", clock->list.offset);
+    for (unsigned pos = 1; pos <= clock->heap_size; pos++) {
+        const ztimer_base_t *entry = _heap_node(clock, pos);
+        printf(" %p:%" PRIu32 "(%" PRIu32 ")", (const void *)entry,
+               _key(clock, entry), entry->offset);
+    }
+    puts("");
+}
+#endif /* MODULE_ZTIMER_HEAP */
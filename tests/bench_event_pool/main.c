@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare a burst of events handled by the shared event
+ *              thread and by an event pool
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event/pool.h"
+#include "event/thread.h"
+#include "irq.h"
+#include "mutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef EVENTS_NUMOF
+#define EVENTS_NUMOF        (32U)
+#endif
+
+#ifndef WORKERS_NUMOF
+#define WORKERS_NUMOF       (4U)
+#endif
+
+#ifndef HANDLER_US
+#define HANDLER_US          (1000U)
+#endif
+
+typedef enum {
+    LOAD_BLOCKING,
+    LOAD_NOP,
+} load_t;
+
+static char _stacks[WORKERS_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static event_pool_worker_t _workers[WORKERS_NUMOF];
+static event_pool_t _pool;
+
+static event_t _events[EVENTS_NUMOF];
+static load_t _load;
+static unsigned _pending;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+
+static void _handler(event_t *event)
+{
+    (void)event;
+
+    if (_load == LOAD_BLOCKING) {
+        ztimer_sleep(ZTIMER_USEC, HANDLER_US);
+    }
+
+    unsigned state = irq_disable();
+    unsigned pending = --_pending;
+    irq_restore(state);
+
+    if (!pending) {
+        mutex_unlock(&_done);
+    }
+}
+
+static void _run(const char *name, event_pool_t *pool, unsigned workers,
+                 load_t load)
+{
+    _load = load;
+    _pending = EVENTS_NUMOF;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        if (pool) {
+            event_pool_post(pool, &_events[i]);
+        }
+        else {
+            event_post(EVENT_PRIO_MEDIUM, &_events[i]);
+        }
+    }
+    mutex_lock(&_done);
+    uint32_t result = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"queue\" : \"%s\", \"workers\" : %u, \"load\" : \"%s\", "
+           "\"events\" : %u, \"result_us\" : %" PRIu32 " }\n",
+           name, workers, (load == LOAD_BLOCKING) ? "blocking" : "nop",
+           EVENTS_NUMOF, result);
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        _events[i].handler = _handler;
+    }
+
+    /* the workers run at the priority of the shared event thread */
+    event_pool_init(&_pool, _workers, WORKERS_NUMOF, _stacks[0],
+                    sizeof(_stacks[0]), THREAD_PRIORITY_MAIN - 1);
+
+    for (load_t load = LOAD_BLOCKING; load <= LOAD_NOP; load++) {
+        _run("event_thread", NULL, 1, load);
+        _run("event_pool", &_pool, WORKERS_NUMOF, load);
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT Developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for load in ("blocking", "nop"):
+        for queue in ("event_thread", "event_pool"):
+            child.expect(r"{ \"queue\" : \"%s\", \"workers\" : \d+, "
+                         r"\"load\" : \"%s\", \"events\" : \d+, "
+                         r"\"result_us\" : \d+ }" % (queue, load))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the NIB forwarding lookup with a growing number of
+ *              forwarding table entries
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "random.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef LOOKUPS_NUMOF
+#define LOOKUPS_NUMOF       (10000U)
+#endif
+
+#define PFX_LEN             (48U)
+
+static const unsigned _numof[] = { 16, 128, 1024 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+/* 2001:db8:<i>::/48 */
+static void _route_pfx(ipv6_addr_t *pfx, unsigned i)
+{
+    memset(pfx, 0, sizeof(*pfx));
+    pfx->u16[0] = byteorder_htons(0x2001);
+    pfx->u16[1] = byteorder_htons(0x0db8);
+    pfx->u16[2] = byteorder_htons(i);
+}
+
+/* fe80::<i + 1> with link-layer address 02:00:00:00:<i + 1> */
+static void _next_hop(ipv6_addr_t *addr, uint8_t *l2addr, unsigned i)
+{
+    ipv6_addr_set_link_local_prefix(addr);
+    memset(&addr->u64[1], 0, sizeof(addr->u64[1]));
+    addr->u16[7] = byteorder_htons(i + 1);
+    memset(l2addr, 0, ETHERNET_ADDR_LEN);
+    l2addr[0] = 0x02;
+    l2addr[4] = (i + 1) >> 8;
+    l2addr[5] = (i + 1) & 0xff;
+}
+
+static void _add_entries(unsigned from, unsigned to)
+{
+    for (unsigned i = from; i < to; i++) {
+        ipv6_addr_t pfx, next_hop;
+        uint8_t l2addr[ETHERNET_ADDR_LEN];
+
+        _route_pfx(&pfx, i);
+        _next_hop(&next_hop, l2addr, i);
+        expect(gnrc_ipv6_nib_nc_set(&next_hop, _netif.pid, l2addr,
+                                    sizeof(l2addr)) == 0);
+        expect(gnrc_ipv6_nib_ft_add(&pfx, PFX_LEN, &next_hop, _netif.pid,
+                                    0) == 0);
+    }
+}
+
+static void _bench(unsigned numof)
+{
+    uint32_t time = 0;
+
+    for (unsigned n = 0; n < LOOKUPS_NUMOF; n++) {
+        gnrc_ipv6_nib_nc_t nce;
+        ipv6_addr_t dst, next_hop;
+        uint8_t l2addr[ETHERNET_ADDR_LEN];
+        unsigned i = random_uint32_range(0, numof);
+
+        _route_pfx(&dst, i);
+        dst.u32[3].u32 = random_uint32();
+        _next_hop(&next_hop, l2addr, i);
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        int res = gnrc_ipv6_nib_get_next_hop_l2addr(&dst, &_netif, NULL,
+                                                    &nce);
+        time += ztimer_now(ZTIMER_USEC) - start;
+
+        expect(res == 0);
+        expect(ipv6_addr_equal(&nce.ipv6, &next_hop));
+        expect(memcmp(nce.l2addr, l2addr, sizeof(l2addr)) == 0);
+    }
+    printf("{ \"entries\" : %u, \"index\" : %u, \"lookup_ns\" : %lu }\n",
+           numof, (unsigned)CONFIG_GNRC_IPV6_NIB_INDEX,
+           (unsigned long)(((uint64_t)time * NS_PER_US) / LOOKUPS_NUMOF));
+}
+
+int main(void)
+{
+    unsigned entries = 0;
+
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "bench_eth",
+                                      &_netdev.netdev.netdev) == 0);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof); i++) {
+        if (_numof[i] > ENTRIES_MAX) {
+            break;
+        }
+        _add_entries(entries, _numof[i]);
+        entries = _numof[i];
+        _bench(entries);
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT Developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for entries in (16, 128, 1024):
+        child.expect(r"{ \"entries\" : %d, \"index\" : [01], "
+                     r"\"lookup_ns\" : \d+ }" % entries)
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the UDP demultiplexing cost of gnrc_netreg
+ *              against the number of registered sockets
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "random.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef LOOKUPS_NUMOF
+#define LOOKUPS_NUMOF       (10000U)
+#endif
+
+#define SOCKETS_MAX         (128U)
+#define PORT_BASE           (1024U)
+
+static const unsigned _numof[] = { 1, 8, 32, 64, SOCKETS_MAX };
+
+static msg_t _msg_queue[4];
+static gnrc_netreg_entry_t _entries[SOCKETS_MAX];
+/* second listener on every even port */
+static gnrc_netreg_entry_t _second[SOCKETS_MAX / 2];
+
+static void _register(unsigned from, unsigned to)
+{
+    for (unsigned i = from; i < to; i++) {
+        gnrc_netreg_entry_init_pid(&_entries[i], PORT_BASE + i,
+                                   thread_getpid());
+        expect(gnrc_netreg_register(GNRC_NETTYPE_UDP, &_entries[i]) == 0);
+        if ((i % 2) == 0) {
+            gnrc_netreg_entry_init_pid(&_second[i / 2], PORT_BASE + i,
+                                       thread_getpid());
+            expect(gnrc_netreg_register(GNRC_NETTYPE_UDP,
+                                        &_second[i / 2]) == 0);
+        }
+    }
+}
+
+static void _bench(unsigned numof)
+{
+    uint32_t time = 0;
+
+    for (unsigned n = 0; n < LOOKUPS_NUMOF; n++) {
+        unsigned i = random_uint32_range(0, numof);
+        unsigned found = 0;
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (gnrc_netreg_entry_t *entry = gnrc_netreg_lookup(GNRC_NETTYPE_UDP,
+                                                             PORT_BASE + i);
+             entry != NULL; entry = gnrc_netreg_getnext(entry)) {
+            found++;
+        }
+        time += ztimer_now(ZTIMER_USEC) - start;
+
+        expect(found == (((i % 2) == 0) ? 2U : 1U));
+    }
+    printf("{ \"sockets\" : %u, \"buckets\" : %u, \"lookup_ns\" : %lu }\n",
+           numof, (unsigned)CONFIG_GNRC_NETREG_BUCKETS,
+           (unsigned long)(((uint64_t)time * NS_PER_US) / LOOKUPS_NUMOF));
+}
+
+int main(void)
+{
+    unsigned sockets = 0;
+
+    /* only threads with a message queue may register */
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof); i++) {
+        _register(sockets, _numof[i]);
+        sockets = _numof[i];
+        _bench(sockets);
+    }
+    /* no datagram to an unbound port may find a receiver */
+    expect(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, PORT_BASE + SOCKETS_MAX) == NULL);
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT Developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for sockets in (1, 8, 32, 64, 128):
+        child.expect(r"{ \"sockets\" : %d, \"buckets\" : \d+, "
+                     r"\"lookup_ns\" : \d+ }" % sockets)
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the packet rate of 6LoWPAN header compression for
+ *              steady-state UDP flows
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/udp.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef PKTS_NUMOF
+#define PKTS_NUMOF          (1000U)
+#endif
+
+#define MAX_PDU_SIZE        (127U)
+#define TEST_PORT           (5683U)
+#define TEST_PAYLOAD        "iphc-bench"
+/* end of the frame control field and sequence number in the MAC header */
+#define MHR_SEQ_END         (3U)
+#define TEST_CTX_ID         (0U)
+#define TEST_CTX_LTIME      (60U)
+#define LOCAL_EUI64         { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }
+#define REMOTE_EUI64        { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }
+
+static const uint8_t _local_eui64[] = LOCAL_EUI64;
+static const uint8_t _remote_eui64[] = REMOTE_EUI64;
+/* the interface identifiers of both EUI-64 */
+static const uint8_t _local_iid[] = { 0x00, 0x00, 0x00, 0xff,
+                                      0xfe, 0x00, 0x00, 0x01 };
+static const uint8_t _remote_iid[] = { 0x00, 0x00, 0x00, 0xff,
+                                       0xfe, 0x00, 0x00, 0x02 };
+static const ipv6_addr_t _ctx_prefix = { .u8 = { 0xfd, 0x01 } };
+
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _netdev;
+
+static uint8_t _frame[MAX_PDU_SIZE];
+static size_t _frame_len;
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = MAX_PDU_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_eui64));
+    memcpy(value, _local_eui64, sizeof(_local_eui64));
+    return sizeof(_local_eui64);
+}
+
+/* only frames ending with the test payload are of the benchmarked flow */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    size_t len = 0;
+
+    (void)dev;
+    for (const iolist_t *iol = iolist; iol != NULL; iol = iol->iol_next) {
+        expect((len + iol->iol_len) <= sizeof(_frame));
+        memcpy(&_frame[len], iol->iol_base, iol->iol_len);
+        len += iol->iol_len;
+    }
+    if ((len >= sizeof(TEST_PAYLOAD)) &&
+        (memcmp(&_frame[len - sizeof(TEST_PAYLOAD)], TEST_PAYLOAD,
+                sizeof(TEST_PAYLOAD)) == 0)) {
+        _frame_len = len;
+        mutex_unlock(&_sent);
+    }
+    return len;
+}
+
+static void _init_addr(ipv6_addr_t *addr, const ipv6_addr_t *prefix,
+                       const uint8_t *iid)
+{
+    memset(addr, 0, sizeof(*addr));
+    ipv6_addr_init_prefix(addr, prefix, 64);
+    memcpy(&addr->u8[8], iid, 8);
+}
+
+static gnrc_pktsnip_t *_build(const ipv6_addr_t *src, const ipv6_addr_t *dst)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+    ipv6_hdr_t *ipv6_hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_PAYLOAD, sizeof(TEST_PAYLOAD),
+                          GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, TEST_PORT, TEST_PORT);
+    expect(pkt != NULL);
+    ((udp_hdr_t *)pkt->data)->length = byteorder_htons(gnrc_pkt_len(pkt));
+    pkt = gnrc_ipv6_hdr_build(pkt, src, dst);
+    expect(pkt != NULL);
+    ipv6_hdr = pkt->data;
+    ipv6_hdr->len = byteorder_htons(gnrc_pkt_len(pkt->next));
+    ipv6_hdr->nh = PROTNUM_UDP;
+    ipv6_hdr->hl = 64;
+    netif = gnrc_netif_hdr_build(NULL, 0, _remote_eui64, sizeof(_remote_eui64));
+    expect(netif != NULL);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    return gnrc_pkt_prepend(pkt, netif);
+}
+
+static size_t _send_pkt(const ipv6_addr_t *src, const ipv6_addr_t *dst)
+{
+    expect(gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                     GNRC_NETREG_DEMUX_CTX_ALL,
+                                     _build(src, dst)) == 1);
+    mutex_lock(&_sent);
+    return _frame_len;
+}
+
+static size_t _bench(const char *flow, const ipv6_addr_t *src,
+                     const ipv6_addr_t *dst)
+{
+    uint8_t first[MAX_PDU_SIZE];
+    size_t first_len;
+    uint32_t start, duration;
+
+    first_len = _send_pkt(src, dst);
+    memcpy(first, _frame, first_len);
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < PKTS_NUMOF; i++) {
+        /* the sequence number in the MAC header changes, the rest must not */
+        expect(_send_pkt(src, dst) == first_len);
+        expect(memcmp(&_frame[MHR_SEQ_END], &first[MHR_SEQ_END],
+                      first_len - MHR_SEQ_END) == 0);
+    }
+    duration = ztimer_now(ZTIMER_USEC) - start;
+    printf("{ \"flow\" : \"%s\", \"iphc_cache\" : %u, \"frame_len\" : %u, "
+           "\"pkts_per_s\" : %lu }\n", flow,
+           IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE), (unsigned)first_len,
+           (unsigned long)(((uint64_t)PKTS_NUMOF * US_PER_SEC) / duration));
+    return first_len;
+}
+
+int main(void)
+{
+    ipv6_addr_t ll_prefix, src, dst;
+    size_t ctx_len;
+
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_send_cb(&_netdev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "iphc_bench",
+                                        &_netdev.netdev.netdev) == 0);
+
+    ipv6_addr_set_link_local_prefix(&ll_prefix);
+    _init_addr(&src, &ll_prefix, _local_iid);
+    _init_addr(&dst, &ll_prefix, _remote_iid);
+    _bench("link-local", &src, &dst);
+
+    expect(gnrc_sixlowpan_ctx_update(TEST_CTX_ID, &_ctx_prefix, 64,
+                                     TEST_CTX_LTIME, true) != NULL);
+    _init_addr(&src, &_ctx_prefix, _local_iid);
+    _init_addr(&dst, &_ctx_prefix, _remote_iid);
+    ctx_len = _bench("context", &src, &dst);
+
+    /* both addresses are carried inline without the context */
+    gnrc_sixlowpan_ctx_remove(TEST_CTX_ID);
+    expect(_send_pkt(&src, &dst) == ctx_len + (2 * sizeof(ipv6_addr_t)));
+    puts("context removal applied");
+    puts("SUCCESS");
+
+    return 0;
+}
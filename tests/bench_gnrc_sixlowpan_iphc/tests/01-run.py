@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT Developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for flow in ("link-local", "context"):
+        child.expect(r"{ \"flow\" : \"%s\", \"iphc_cache\" : [01], "
+                     r"\"frame_len\" : \d+, \"pkts_per_s\" : \d+ }" % flow)
+    child.expect_exact("context removal applied")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the goodput of a GNRC TCP bulk transfer to another
+ *              RIOT instance or over the IPv6 loopback address
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE       (65536U)
+#endif
+
+#define SERVER_PORT         (8080U)
+#define BUFFER_SIZE         (CONFIG_GNRC_TCP_MSS)
+#define TIMEOUT_MS          (10U * MS_PER_SEC)
+#define MAIN_QUEUE_SIZE     (8)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static char _server_stack[THREAD_STACKSIZE_MAIN];
+static gnrc_tcp_tcb_t _server_tcb;
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static char _server_buf[BUFFER_SIZE];
+static char _client_buf[BUFFER_SIZE];
+
+static void *_server(void *arg)
+{
+    (void)arg;
+    while (1) {
+        gnrc_tcp_tcb_t *tcb;
+        size_t received = 0;
+        ssize_t res;
+
+        if (gnrc_tcp_accept(&_queue, &tcb, TIMEOUT_MS) != 0) {
+            continue;
+        }
+        /* the connection is closed by the client once everything was sent */
+        while ((res = gnrc_tcp_recv(tcb, _server_buf, sizeof(_server_buf),
+                                    TIMEOUT_MS)) > 0) {
+            received += res;
+        }
+        gnrc_tcp_close(tcb);
+        printf("server: received %u byte\n", (unsigned)received);
+    }
+    return NULL;
+}
+
+static int _bench_cmd(int argc, char **argv)
+{
+    gnrc_tcp_tcb_t tcb;
+    gnrc_tcp_ep_t remote;
+    uint32_t start, duration;
+    size_t sent = 0;
+    int res;
+
+    if (argc < 2) {
+        printf("usage: %s <[addr%%netif]:port>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        printf("%s: invalid endpoint\n", argv[0]);
+        return 1;
+    }
+    if (remote.port == 0) {
+        remote.port = SERVER_PORT;
+    }
+    gnrc_tcp_tcb_init(&tcb);
+    res = gnrc_tcp_open(&tcb, &remote, 0);
+    if (res < 0) {
+        printf("%s: gnrc_tcp_open failed with %d\n", argv[0], res);
+        return 1;
+    }
+
+    memset(_client_buf, 'x', sizeof(_client_buf));
+    start = ztimer_now(ZTIMER_USEC);
+    while (sent < TRANSFER_SIZE) {
+        size_t len = TRANSFER_SIZE - sent;
+        ssize_t ret;
+
+        if (len > sizeof(_client_buf)) {
+            len = sizeof(_client_buf);
+        }
+        ret = gnrc_tcp_send(&tcb, _client_buf, len, TIMEOUT_MS);
+        if (ret <= 0) {
+            printf("%s: gnrc_tcp_send failed with %d\n", argv[0], (int)ret);
+            gnrc_tcp_abort(&tcb);
+            return 1;
+        }
+        sent += ret;
+    }
+    /* returns once the server acknowledged all data and the FIN */
+    gnrc_tcp_close(&tcb);
+    duration = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"bytes\" : %u, \"window_mss\" : %u, \"retransmit_queue_size\" : %u, "
+           "\"duration_us\" : %lu, \"goodput_kbps\" : %lu }\n",
+           (unsigned)TRANSFER_SIZE, CONFIG_GNRC_TCP_MSS_MULTIPLICATOR,
+           CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE, (unsigned long)duration,
+           (unsigned long)(((uint64_t)TRANSFER_SIZE * 8 * US_PER_MS) / duration));
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "bench", "send TRANSFER_SIZE byte to a bench server", _bench_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    gnrc_tcp_ep_t local;
+
+    /* we need a message queue for the thread running the shell in order to
+     * receive potentially fast incoming networking packets */
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+    /* every instance serves the bench command of its peers */
+    gnrc_tcp_tcb_init(&_server_tcb);
+    expect(gnrc_tcp_ep_from_str(&local, "[::]") == 0);
+    local.port = SERVER_PORT;
+    expect(gnrc_tcp_listen(&_queue, &_server_tcb, 1, &local) == 0);
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _server, NULL, "tcp_server");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
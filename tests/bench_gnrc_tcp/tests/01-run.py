@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT Developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+import pexpect
+from testrunner import run
+
+# Tap device of a second instance to send to, see README.md. Without it, the
+# transfer runs over the loopback address of a single instance.
+PEER_TAP = os.environ.get('PEER_TAP')
+
+RESULT = (r"{ \"bytes\" : \d+, \"window_mss\" : \d+, "
+          r"\"retransmit_queue_size\" : \d+, \"duration_us\" : \d+, "
+          r"\"goodput_kbps\" : \d+ }")
+
+
+def get_ll_addr(child):
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s')
+    netif = child.match.group(1)
+    child.expect(r'(fe80:[0-9a-f:]+)\s')
+    return '{}%{}'.format(child.match.group(1), netif)
+
+
+def testfunc(child):
+    if PEER_TAP:
+        env = dict(os.environ, PORT=PEER_TAP)
+        peer = pexpect.spawnu('make', ['term'], env=env, timeout=child.timeout)
+        try:
+            peer.expect_exact('>')
+            server = get_ll_addr(peer)
+            # the sender resolves the link layer address of the server
+            child.sendline('bench [{}]:8080'.format(server))
+            child.expect(RESULT, timeout=60)
+            peer.expect(r'server: received \d+ byte')
+        finally:
+            peer.terminate(force=True)
+    else:
+        child.sendline('bench [::1]:8080')
+        child.expect(RESULT, timeout=60)
+        child.expect(r'server: received \d+ byte')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
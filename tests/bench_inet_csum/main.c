@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares the Internet checksum against a 16-bit reference
+ *              implementation for correctness and throughput
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/inet_csum.h"
+#include "random.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef FUZZ_NUMOF
+#define FUZZ_NUMOF          (10000U)
+#endif
+
+#ifndef ROUNDS_NUMOF
+#define ROUNDS_NUMOF        (1000U)
+#endif
+
+#define SEED                (0x5eed)
+/* IPv6 minimum MTU minus IPv6 and UDP header */
+#define BUF_SIZE            (1232U)
+
+static const uint16_t _sizes[] = { 8, 40, 127, BUF_SIZE };
+
+static uint32_t _buf[(BUF_SIZE + sizeof(uint32_t)) / sizeof(uint32_t)];
+
+/* inet_csum_slice() as it summed 16 bits per step */
+static uint16_t _reference(uint16_t sum, const uint8_t *buf, uint16_t len,
+                           size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+    return csum;
+}
+
+static void _fuzz(void)
+{
+    uint8_t *buf = (uint8_t *)_buf;
+
+    for (unsigned n = 0; n < FUZZ_NUMOF; n++) {
+        unsigned offset = random_uint32_range(0, sizeof(uint32_t));
+        uint16_t len = random_uint32_range(0, BUF_SIZE + 1);
+        uint16_t sum = random_uint32();
+        size_t accum_len = random_uint32_range(0, 2);
+        uint16_t expected, res;
+
+        /* runs of 0xff and 0x00 to provoke many and no carries */
+        switch (n % 4) {
+        case 0:
+            memset(buf, 0xff, sizeof(_buf));
+            break;
+        case 1:
+            memset(buf, 0x00, sizeof(_buf));
+            break;
+        default:
+            random_bytes(buf, sizeof(_buf));
+            break;
+        }
+        expected = _reference(sum, buf + offset, len, accum_len);
+        res = inet_csum_slice(sum, buf + offset, len, accum_len);
+        if (res != expected) {
+            printf("offset %u, len %u, sum 0x%04x, accum_len %u: "
+                   "0x%04x != 0x%04x\n", offset, len, sum,
+                   (unsigned)accum_len, res, expected);
+            expect(0);
+        }
+    }
+    printf("compared %u random checksums: OK\n", FUZZ_NUMOF);
+}
+
+static void _bench(uint16_t size)
+{
+    const uint8_t *buf = (const uint8_t *)_buf;
+    /* volatile to keep the sums from being optimized out */
+    volatile uint16_t sum;
+    uint32_t start, reference, optimized;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS_NUMOF; i++) {
+        sum = _reference(i, buf, size, 0);
+    }
+    reference = ztimer_now(ZTIMER_USEC) - start;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS_NUMOF; i++) {
+        sum = inet_csum(i, buf, size);
+    }
+    optimized = ztimer_now(ZTIMER_USEC) - start;
+    (void)sum;
+    printf("{ \"size\" : %u, \"reference_ns\" : %lu, \"inet_csum_ns\" : %lu }\n",
+           size,
+           (unsigned long)(((uint64_t)reference * NS_PER_US) / ROUNDS_NUMOF),
+           (unsigned long)(((uint64_t)optimized * NS_PER_US) / ROUNDS_NUMOF));
+}
+
+int main(void)
+{
+    random_init(SEED);
+    _fuzz();
+    random_bytes((uint8_t *)_buf, sizeof(_buf));
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        _bench(_sizes[i]);
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT Developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"compared (\d+) random checksums: OK")
+    for size in (8, 40, 127, 1232):
+        child.expect(r"{ \"size\" : %d, \"reference_ns\" : \d+, "
+                     r"\"inet_csum_ns\" : \d+ }" % size)
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
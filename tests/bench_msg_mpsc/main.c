@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare cib_t based and lock-free message queues with
+ *              multiple producers
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include "thread.h"
+
+#include "msg.h"
+#include "msg_mpsc.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef PRODUCER_NUMOF
+#define PRODUCER_NUMOF      (3U)
+#endif
+
+#define QUEUE_SIZE          (16U)
+
+static char _producer_stacks[PRODUCER_NUMOF][THREAD_STACKSIZE_MAIN];
+static char _cib_stack[THREAD_STACKSIZE_MAIN];
+static char _mpsc_stack[THREAD_STACKSIZE_MAIN];
+
+static volatile kernel_pid_t _target;
+static volatile uint32_t _cib_count;
+static volatile uint32_t _mpsc_count;
+
+static void *_producer(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        msg_t test;
+        msg_send(&test, _target);
+    }
+
+    return NULL;
+}
+
+static void *_cib_consumer(void *arg)
+{
+    (void)arg;
+    static msg_t queue[QUEUE_SIZE];
+
+    msg_init_queue(queue, QUEUE_SIZE);
+
+    while (1) {
+        msg_t test;
+        msg_receive(&test);
+        _cib_count++;
+    }
+
+    return NULL;
+}
+
+static void *_mpsc_consumer(void *arg)
+{
+    (void)arg;
+    static msg_mpsc_slot_t slots[QUEUE_SIZE];
+    static msg_mpsc_t queue;
+
+    msg_init_queue_mpsc(&queue, slots, QUEUE_SIZE);
+
+    while (1) {
+        msg_t test;
+        msg_receive(&test);
+        _mpsc_count++;
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    kernel_pid_t cib = thread_create(_cib_stack, sizeof(_cib_stack),
+                                     THREAD_PRIORITY_MAIN + 2,
+                                     THREAD_CREATE_STACKTEST,
+                                     _cib_consumer, NULL, "cib");
+    kernel_pid_t mpsc = thread_create(_mpsc_stack, sizeof(_mpsc_stack),
+                                      THREAD_PRIORITY_MAIN + 2,
+                                      THREAD_CREATE_STACKTEST,
+                                      _mpsc_consumer, NULL, "mpsc");
+
+    _target = cib;
+    for (unsigned i = 0; i < PRODUCER_NUMOF; i++) {
+        thread_create(_producer_stacks[i], sizeof(_producer_stacks[i]),
+                      THREAD_PRIORITY_MAIN + 1, THREAD_CREATE_STACKTEST,
+                      _producer, NULL, "producer");
+    }
+
+    xtimer_usleep(TEST_DURATION_US);
+    _target = mpsc;
+    uint32_t n = _cib_count;
+    printf("{ \"queue\" : \"cib\", \"result\" : %"PRIu32" }\n", n);
+
+    xtimer_usleep(TEST_DURATION_US);
+    n = _mpsc_count;
+    printf("{ \"queue\" : \"mpsc\", \"result\" : %"PRIu32" }\n", n);
+
+    return 0;
+}
@@ -11,7 +11,8 @@
  * @{
  *
  * @file
- * @brief       Measure messages send per second
+ * @brief       Measure messages send per second, also using batched
+ *              msg_send_batch() / msg_receive_batch()
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
@@ -30,7 +31,10 @@
 #define TEST_DURATION_US    (1000000U)
 #endif
 
+#define BATCH_SIZE_MAX      (16U)
+
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _batch_stack[THREAD_STACKSIZE_MAIN];
 
 static void _timer_callback(void *flag)
 {
@@ -49,6 +53,47 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_batch_thread(void *arg)
+{
+    (void)arg;
+    static msg_t queue[BATCH_SIZE_MAX];
+
+    msg_init_queue(queue, BATCH_SIZE_MAX);
+
+    while (1) {
+        msg_t test[BATCH_SIZE_MAX];
+        msg_receive_batch(test, BATCH_SIZE_MAX);
+    }
+
+    return NULL;
+}
+
+static void _run_batch(kernel_pid_t target, unsigned batch_size)
+{
+    atomic_flag flag = ATOMIC_FLAG_INIT;
+    uint32_t n = 0;
+
+    xtimer_t timer = {
+        .callback = _timer_callback,
+        .arg = &flag,
+    };
+
+    atomic_flag_test_and_set(&flag);
+    xtimer_set(&timer, TEST_DURATION_US);
+
+    while (atomic_flag_test_and_set(&flag)) {
+        msg_t test[BATCH_SIZE_MAX];
+        int res = msg_send_batch(test, batch_size, target);
+        if (res > 0) {
+            n += res;
+        }
+    }
+
+    /* messages per second, as the test runs for TEST_DURATION_US */
+    printf("{ \"batch\" : %u, \"result\" : %"PRIu32" }\n", batch_size,
+           (uint32_t)(((uint64_t)n * US_PER_SEC) / TEST_DURATION_US));
+}
+
 int main(void)
 {
     puts("main starting");
@@ -85,5 +130,18 @@ int main(void)
 #endif
     puts(" }");
 
+    kernel_pid_t batch = thread_create(_batch_stack,
+                                       sizeof(_batch_stack),
+                                       (THREAD_PRIORITY_MAIN - 1),
+                                       THREAD_CREATE_STACKTEST,
+                                       _batch_thread,
+                                       NULL,
+                                       "batch_thread");
+
+    static const unsigned batch_sizes[] = { 1, 4, 16 };
+    for (unsigned i = 0; i < ARRAY_SIZE(batch_sizes); i++) {
+        _run_batch(batch, batch_sizes[i]);
+    }
+
     return 0;
 }
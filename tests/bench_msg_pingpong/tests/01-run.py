@@ -13,6 +13,9 @@ from testrunner import run
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    for batch_size in (1, 4, 16):
+        child.expect(r"{{ \"batch\" : {}, \"result\" : \d+ }}"
+                     .format(batch_size))
 
 
 if __name__ == "__main__":
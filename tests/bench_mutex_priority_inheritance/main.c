@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure worst-case mutex wake latency under priority inversion
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS              (100U)
+#endif
+
+#ifndef CRITICAL_SECTION_US
+#define CRITICAL_SECTION_US     (1000U)
+#endif
+
+#ifndef MID_PERIOD_US
+#define MID_PERIOD_US           (3000U)
+#endif
+
+#ifndef MID_BUSY_US
+#define MID_BUSY_US             (5000U)
+#endif
+
+#ifndef HIGH_PERIOD_US
+#define HIGH_PERIOD_US          (7000U)
+#endif
+
+static char _low_stack[THREAD_STACKSIZE_DEFAULT];
+static char _mid_stack[THREAD_STACKSIZE_DEFAULT];
+static char _high_stack[THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t _mutex = MUTEX_INIT;
+static volatile bool _done;
+
+static void *_low(void *arg)
+{
+    (void)arg;
+
+    while (!_done) {
+        mutex_lock(&_mutex);
+        ztimer_spin(ZTIMER_USEC, CRITICAL_SECTION_US);
+        mutex_unlock(&_mutex);
+    }
+
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+
+    while (!_done) {
+        ztimer_sleep(ZTIMER_USEC, MID_PERIOD_US);
+        ztimer_spin(ZTIMER_USEC, MID_BUSY_US);
+    }
+
+    return NULL;
+}
+
+static void *_high(void *arg)
+{
+    (void)arg;
+    uint32_t max = 0;
+    uint64_t sum = 0;
+
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        ztimer_sleep(ZTIMER_USEC, HIGH_PERIOD_US);
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        mutex_lock(&_mutex);
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - start;
+        mutex_unlock(&_mutex);
+
+        sum += latency;
+        if (latency > max) {
+            max = latency;
+        }
+    }
+
+    _done = true;
+
+    printf("{ \"priority_inheritance\" : %u, \"max_latency_us\" : %" PRIu32
+           ", \"avg_latency_us\" : %" PRIu32 " }\n",
+           (unsigned)IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE), max,
+           (uint32_t)(sum / ITERATIONS));
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    thread_create(_low_stack, sizeof(_low_stack), THREAD_PRIORITY_MAIN + 3,
+                  THREAD_CREATE_STACKTEST, _low, NULL, "low");
+    thread_create(_mid_stack, sizeof(_mid_stack), THREAD_PRIORITY_MAIN + 2,
+                  THREAD_CREATE_STACKTEST, _mid, NULL, "mid");
+    thread_create(_high_stack, sizeof(_high_stack), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_STACKTEST, _high, NULL, "high");
+
+    return 0;
+}
@@ -23,6 +23,9 @@
 #include "macros/units.h"
 #include "thread.h"
 #include "xtimer.h"
+#ifdef MODULE_SCHED_ROUND_ROBIN
+#include "sched_round_robin.h"
+#endif
 
 #ifndef TEST_DURATION
 #define TEST_DURATION       (1000000U)
@@ -49,33 +52,63 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
-int main(void)
+static uint32_t _measure(void)
 {
-    printf("main starting\n");
-
-    thread_create(_stack,
-                  sizeof(_stack),
-                  THREAD_PRIORITY_MAIN,
-                  THREAD_CREATE_STACKTEST,
-                  _second_thread,
-                  NULL,
-                  "second_thread");
-
     xtimer_t timer;
     timer.callback = _timer_callback;
 
     uint32_t n = 0;
 
+    _flag = 0;
     xtimer_set(&timer, TEST_DURATION);
     while(!_flag) {
         thread_yield();
         n++;
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
+    return n;
+}
+
+static void _print_result(const char *prefix, uint32_t n)
+{
+    printf("\"%sresult\" : %"PRIu32, prefix, n);
 #ifdef CLOCK_CORECLOCK
-    printf(", \"ticks\" : %"PRIu32,
+    printf(", \"%sticks\" : %"PRIu32, prefix,
            (uint32_t)((TEST_DURATION/US_PER_MS) * (CLOCK_CORECLOCK/KHZ(1)))/n);
+#endif
+}
+
+int main(void)
+{
+    printf("main starting\n");
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    printf("sched_round_robin: %u us time slice\n",
+           (unsigned)CONFIG_SCHED_RR_QUANTUM_US);
+#endif
+
+    thread_create(_stack,
+                  sizeof(_stack),
+                  THREAD_PRIORITY_MAIN,
+                  THREAD_CREATE_STACKTEST,
+                  _second_thread,
+                  NULL,
+                  "second_thread");
+
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    /* measure without time slicing first, then with it */
+    sched_round_robin_enable(false);
+    uint32_t n = _measure();
+    sched_round_robin_enable(true);
+    uint32_t n_rr = _measure();
+#else
+    uint32_t n = _measure();
+#endif
+
+    printf("{ ");
+    _print_result("", n);
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    printf(", ");
+    _print_result("rr_", n_rr);
 #endif
     puts(" }");
 
@@ -12,7 +12,8 @@ from testrunner import run
 
 
 def testfunc(child):
-    child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)?"
+                 r"(, \"rr_result\" : \d+(, \"rr_ticks\" : \d+)?)? }")
 
 
 if __name__ == "__main__":
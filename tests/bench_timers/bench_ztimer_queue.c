@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the ztimer timer queue
+ *
+ * Sets, re-sets and removes N timers on ZTIMER_USEC and prints the average
+ * time per operation for each N. The timers are set far into the future, so
+ * none of them triggers during the benchmark.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "fmt.h"
+#include "kernel_defines.h"
+#include "random.h"
+#include "timex.h"
+
+#include "bench_ztimer_queue.h"
+
+#if TEST_ZTIMER_QUEUE
+#include "ztimer.h"
+
+/* minimum timeout, all timers must stay pending during one round */
+#define OFFSET_MIN      (10LU * US_PER_SEC)
+#define OFFSET_RANGE    (10LU * US_PER_SEC)
+
+static const unsigned _numof[] = { 10, 20, 50, 100, 200, 500, 1000 };
+
+static ztimer_t _timers[ZTIMER_QUEUE_MAX];
+static uint32_t _offsets[ZTIMER_QUEUE_MAX];
+
+static void _cb(void *arg)
+{
+    (void)arg;
+    print_str("Error: timer triggered during benchmark\n");
+}
+
+static void _print_result(unsigned numof, const char *op, uint32_t usec,
+                          unsigned ops)
+{
+    print_str("{ \"timers\" : ");
+    print_u32_dec(numof);
+    print_str(", \"op\" : \"");
+    print_str(op);
+    print_str("\", \"ns_per_op\" : ");
+    print_u32_dec((uint32_t)(((uint64_t)usec * NS_PER_US) / ops));
+    print_str(" }\n");
+}
+
+static void _bench(unsigned numof)
+{
+    unsigned rounds = ZTIMER_QUEUE_OPS / numof;
+    uint32_t t_set = 0;
+    uint32_t t_reset = 0;
+    uint32_t t_remove = 0;
+
+    if (rounds == 0) {
+        rounds = 1;
+    }
+
+    for (unsigned round = 0; round < rounds; round++) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < numof; i++) {
+            ztimer_set(ZTIMER_USEC, &_timers[i], _offsets[i]);
+        }
+        uint32_t set = ztimer_now(ZTIMER_USEC);
+        /* move every timer to a new random position in the queue */
+        for (unsigned i = 0; i < numof; i++) {
+            ztimer_set(ZTIMER_USEC, &_timers[i],
+                       _offsets[(i + numof / 2) % numof]);
+        }
+        uint32_t reset = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < numof; i++) {
+            ztimer_remove(ZTIMER_USEC, &_timers[i]);
+        }
+        uint32_t removed = ztimer_now(ZTIMER_USEC);
+
+        t_set += set - start;
+        t_reset += reset - set;
+        t_remove += removed - reset;
+    }
+
+    _print_result(numof, "set", t_set, rounds * numof);
+    _print_result(numof, "reset", t_reset, rounds * numof);
+    _print_result(numof, "remove", t_remove, rounds * numof);
+}
+
+void bench_ztimer_queue(void)
+{
+    print_str("ztimer queue benchmark, ");
+    print_str(IS_USED(MODULE_ZTIMER_HEAP) ? "heap" : "list");
+    print_str(" implementation\n");
+
+    for (unsigned i = 0; i < ZTIMER_QUEUE_MAX; i++) {
+        _timers[i].callback = _cb;
+        _offsets[i] = OFFSET_MIN + random_uint32_range(0, OFFSET_RANGE);
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof); i++) {
+        if (_numof[i] > ZTIMER_QUEUE_MAX) {
+            break;
+        }
+        _bench(_numof[i]);
+    }
+    print_str("ztimer queue benchmark done\n");
+}
+#endif /* TEST_ZTIMER_QUEUE */
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer queue benchmark declarations
+ */
+
+#ifndef BENCH_ZTIMER_QUEUE_H
+#define BENCH_ZTIMER_QUEUE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of concurrently set timers to benchmark
+ */
+#ifndef ZTIMER_QUEUE_MAX
+#define ZTIMER_QUEUE_MAX        (1000U)
+#endif
+
+/**
+ * @brief   Number of operations to time for each number of timers
+ */
+#ifndef ZTIMER_QUEUE_OPS
+#define ZTIMER_QUEUE_OPS        (10000U)
+#endif
+
+/**
+ * @brief   Measure the cost of ztimer_set() and ztimer_remove() on ZTIMER_USEC
+ *          with 10 up to ZTIMER_QUEUE_MAX timers set
+ */
+void bench_ztimer_queue(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_ZTIMER_QUEUE_H */
+/** @} */
@@ -41,6 +41,7 @@
 #include "periph/timer.h"
 #include "test_utils/expect.h"
 
+#include "bench_ztimer_queue.h"
 #include "print_results.h"
 #include "spin_random.h"
 #include "bench_timers_config.h"
@@ -600,6 +601,10 @@ static void estimate_cpu_overhead(void)
 
 int main(void)
 {
+#if TEST_ZTIMER_QUEUE
+    bench_ztimer_queue();
+    return 0;
+#endif
     print_str("\nStatistical benchmark for timers\n");
     for (unsigned int k = 0; k < ARRAY_SIZE(ref_states); ++k) {
         matstat_clear(&ref_states[k]);
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of byte-wise, bulk and span access to tsrb and
+ *              ringbuffer
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ringbuffer.h"
+#include "tsrb.h"
+#include "xtimer.h"
+
+#ifndef TEST_BYTES
+#define TEST_BYTES      (256UL * 1024)
+#endif
+
+#ifndef CHUNK_SIZE
+#define CHUNK_SIZE      (48U)
+#endif
+
+#define BUF_SIZE        (256U)
+#define CHUNKS          (TEST_BYTES / CHUNK_SIZE)
+
+static uint8_t _buf[BUF_SIZE];
+static uint8_t _in[CHUNK_SIZE];
+static uint8_t _out[CHUNK_SIZE];
+static unsigned _failures;
+
+static tsrb_t _tsrb;
+static ringbuffer_t _rb;
+
+static void _tsrb_byte(void)
+{
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        tsrb_add_one(&_tsrb, _in[i]);
+    }
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        _out[i] = tsrb_get_one(&_tsrb);
+    }
+}
+
+static void _tsrb_bulk(void)
+{
+    tsrb_add(&_tsrb, _in, CHUNK_SIZE);
+    tsrb_get(&_tsrb, _out, CHUNK_SIZE);
+}
+
+static void _tsrb_span(void)
+{
+    size_t done = 0;
+
+    while (done < CHUNK_SIZE) {
+        uint8_t *dst;
+        size_t len = tsrb_get_write_span(&_tsrb, &dst);
+        if (len > CHUNK_SIZE - done) {
+            len = CHUNK_SIZE - done;
+        }
+        memcpy(dst, &_in[done], len);
+        tsrb_commit(&_tsrb, len);
+        done += len;
+    }
+
+    done = 0;
+    while (done < CHUNK_SIZE) {
+        const uint8_t *src;
+        size_t len = tsrb_peek_read_span(&_tsrb, &src);
+        if (len > CHUNK_SIZE - done) {
+            len = CHUNK_SIZE - done;
+        }
+        memcpy(&_out[done], src, len);
+        tsrb_consume(&_tsrb, len);
+        done += len;
+    }
+}
+
+static void _rb_byte(void)
+{
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        ringbuffer_add_one(&_rb, _in[i]);
+    }
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        _out[i] = ringbuffer_get_one(&_rb);
+    }
+}
+
+static void _rb_bulk(void)
+{
+    ringbuffer_add(&_rb, (char *)_in, CHUNK_SIZE);
+    ringbuffer_get(&_rb, (char *)_out, CHUNK_SIZE);
+}
+
+static void _rb_span(void)
+{
+    unsigned done = 0;
+
+    while (done < CHUNK_SIZE) {
+        char *dst;
+        unsigned len = ringbuffer_get_write_span(&_rb, &dst);
+        if (len > CHUNK_SIZE - done) {
+            len = CHUNK_SIZE - done;
+        }
+        memcpy(dst, &_in[done], len);
+        ringbuffer_commit(&_rb, len);
+        done += len;
+    }
+
+    done = 0;
+    while (done < CHUNK_SIZE) {
+        const char *src;
+        unsigned len = ringbuffer_peek_read_span(&_rb, &src);
+        if (len > CHUNK_SIZE - done) {
+            len = CHUNK_SIZE - done;
+        }
+        memcpy(&_out[done], src, len);
+        ringbuffer_remove(&_rb, len);
+        done += len;
+    }
+}
+
+static void _run(const char *buffer, const char *path, void (*transfer)(void))
+{
+    tsrb_init(&_tsrb, _buf, sizeof(_buf));
+    ringbuffer_init(&_rb, (char *)_buf, sizeof(_buf));
+
+    uint32_t start = xtimer_now_usec();
+    for (unsigned long i = 0; i < CHUNKS; i++) {
+        transfer();
+    }
+    uint32_t result = xtimer_now_usec() - start;
+
+    /* the data of the last chunk must have made it through unchanged */
+    if (memcmp(_in, _out, sizeof(_in))) {
+        printf("%s %s: data corrupted\n", buffer, path);
+        _failures++;
+    }
+    memset(_out, 0, sizeof(_out));
+
+    printf("{ \"buffer\" : \"%s\", \"path\" : \"%s\", "
+           "\"bytes\" : %lu, \"result_us\" : %" PRIu32 " }\n",
+           buffer, path, CHUNKS * CHUNK_SIZE, result);
+}
+
+int main(void)
+{
+    puts("tsrb/ringbuffer throughput benchmark");
+
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        _in[i] = i + 1;
+    }
+
+    _run("tsrb", "byte", _tsrb_byte);
+    _run("tsrb", "bulk", _tsrb_bulk);
+    _run("tsrb", "span", _tsrb_span);
+    _run("ringbuffer", "byte", _rb_byte);
+    _run("ringbuffer", "bulk", _rb_bulk);
+    _run("ringbuffer", "span", _rb_span);
+
+    puts(_failures ? "FAILURE" : "SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test of the checksum offload to a network device
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/udp.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define TEST_PORT           (5683U)
+#define TEST_PAYLOAD        "test"
+#define INVALID_CSUM        (0x1234U)
+#define FRAME_SIZE          (sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + \
+                             sizeof(udp_hdr_t) + sizeof(TEST_PAYLOAD))
+#define RECV_TIMEOUT_MS     (100U)
+
+static const uint8_t _l2addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+static const uint8_t _l2addr_all_nodes[] = { 0x33, 0x33, 0x00, 0x00, 0x00, 0x01 };
+static ipv6_addr_t _src = { .u8 = { 0xfe, 0x80, 0, 0, 0, 0, 0, 0,
+                                    0, 0, 0, 0, 0, 0, 0x12, 0x34 } };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _msg_queue[4];
+static uint16_t _sent_csum;
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static int _get_enabled(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(netopt_enable_t));
+    *((netopt_enable_t *)value) = NETOPT_ENABLE;
+    return sizeof(netopt_enable_t);
+}
+
+/* frames are Ethernet header, IPv6 header, upper-layer header, payload */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const ipv6_hdr_t *ipv6 = iolist->iol_next->iol_base;
+
+    (void)dev;
+    /* skip neighbor discovery */
+    if (ipv6->nh == PROTNUM_UDP) {
+        const udp_hdr_t *udp = iolist->iol_next->iol_next->iol_base;
+
+        _sent_csum = byteorder_ntohs(udp->checksum);
+        mutex_unlock(&_sent);
+    }
+    return iolist_size(iolist);
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+/* UDP packet from fe80::1 to ff02::1 with an invalid checksum */
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    ethernet_hdr_t *eth = (ethernet_hdr_t *)buf;
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)(eth + 1);
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return FRAME_SIZE;
+    }
+    expect((unsigned)len >= FRAME_SIZE);
+    memset(buf, 0, FRAME_SIZE);
+    memcpy(eth->dst, _l2addr_all_nodes, sizeof(_l2addr_all_nodes));
+    eth->src[0] = 0x02;
+    eth->src[5] = 0x01;
+    eth->type = byteorder_htons(ETHERTYPE_IPV6);
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(sizeof(udp_hdr_t) + sizeof(TEST_PAYLOAD));
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 64;
+    ipv6_addr_set_link_local_prefix(&ipv6->src);
+    ipv6->src.u8[15] = 0x01;
+    ipv6_addr_set_all_nodes_multicast(&ipv6->dst, IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    udp->src_port = byteorder_htons(TEST_PORT);
+    udp->dst_port = byteorder_htons(TEST_PORT);
+    udp->length = byteorder_htons(sizeof(udp_hdr_t) + sizeof(TEST_PAYLOAD));
+    udp->checksum = byteorder_htons(INVALID_CSUM);
+    memcpy(udp + 1, TEST_PAYLOAD, sizeof(TEST_PAYLOAD));
+    return FRAME_SIZE;
+}
+
+static void _test_send(void)
+{
+    ipv6_addr_t dst;
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    ipv6_addr_set_all_nodes_multicast(&dst, IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    pkt = gnrc_pktbuf_add(NULL, TEST_PAYLOAD, sizeof(TEST_PAYLOAD),
+                          GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, TEST_PORT, TEST_PORT);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, &_src, &dst);
+    expect(pkt != NULL);
+    hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    expect(hdr != NULL);
+    gnrc_netif_hdr_set_netif(hdr->data, &_netif);
+    pkt = gnrc_pkt_prepend(pkt, hdr);
+    expect(gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP,
+                                     GNRC_NETREG_DEMUX_CTX_ALL, pkt) == 1);
+    mutex_lock(&_sent);
+    printf("sent UDP packet with checksum 0x%04x\n", _sent_csum);
+    expect(_sent_csum == 0);
+}
+
+static bool _recv_udp(void)
+{
+    msg_t msg;
+    gnrc_pktsnip_t *pkt;
+
+    netdev_trigger_event_isr(&_netdev.netdev.netdev);
+    if (ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg, RECV_TIMEOUT_MS) < 0) {
+        return false;
+    }
+    expect(msg.type == GNRC_NETAPI_MSG_TYPE_RCV);
+    pkt = msg.content.ptr;
+    expect(pkt->size == sizeof(TEST_PAYLOAD));
+    expect(memcmp(pkt->data, TEST_PAYLOAD, sizeof(TEST_PAYLOAD)) == 0);
+    gnrc_pktbuf_release(pkt);
+    return true;
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t reg = GNRC_NETREG_ENTRY_INIT_PID(TEST_PORT,
+                                                         thread_getpid());
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_get_cb(&_netdev, NETOPT_TX_CSUM_OFFLOAD, _get_enabled);
+    netdev_test_set_get_cb(&_netdev, NETOPT_RX_CSUM_VALID, _get_enabled);
+    netdev_test_set_send_cb(&_netdev, _send);
+    netdev_test_set_isr_cb(&_netdev, _isr);
+    netdev_test_set_recv_cb(&_netdev, _recv);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack),
+                                      GNRC_NETIF_PRIO, "csum_eth",
+                                      &_netdev.netdev.netdev) == 0);
+    expect(gnrc_netif_tx_csum_offloaded(&_netif));
+    expect(gnrc_netif_rx_csum_valid(&_netif));
+    /* source address without duplicate address detection */
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_src, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &reg);
+
+    _test_send();
+
+    expect(_recv_udp());
+    puts("received UDP packet with invalid checksum");
+
+    gnrc_netif_acquire(&_netif);
+    _netif.flags &= ~GNRC_NETIF_FLAGS_RX_CSUM_VALID;
+    gnrc_netif_release(&_netif);
+    expect(!_recv_udp());
+    puts("dropped UDP packet with invalid checksum");
+
+    puts("SUCCESS");
+
+    return 0;
+}
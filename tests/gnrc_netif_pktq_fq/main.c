@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test of the queueing delay of a small flow alongside a bulk
+ *              flow with fair queueing in the send queue of an interface
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/pktq.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+
+#define BULK_NUMOF          (10U)
+#define SMALL_NUMOF         (2U)
+#define PKTS_NUMOF          (BULK_NUMOF + SMALL_NUMOF)
+#define BULK_PORT           (5684U)
+#define SMALL_PORT          (5683U)
+#define BULK_SIZE           (512U)
+#define SMALL_SIZE          (16U)
+
+static const uint8_t _l2addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+static const uint8_t _dst_l2addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static volatile bool _busy = true;
+static uint16_t _sent_ports[PKTS_NUMOF];
+static volatile unsigned _sent;
+static mutex_t _all_sent = MUTEX_INIT_LOCKED;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+/* frames are Ethernet header, IPv6 header, UDP header, payload */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const udp_hdr_t *udp = iolist->iol_next->iol_next->iol_base;
+
+    (void)dev;
+    if (_busy) {
+        return -EBUSY;
+    }
+    expect(_sent < PKTS_NUMOF);
+    _sent_ports[_sent++] = byteorder_ntohs(udp->dst_port);
+    if (_sent == PKTS_NUMOF) {
+        mutex_unlock(&_all_sent);
+    }
+    return iolist_size(iolist);
+}
+
+static gnrc_pktsnip_t *_build(uint16_t port, size_t size)
+{
+    gnrc_pktsnip_t *payload, *udp, *ipv6, *netif;
+    udp_hdr_t *udp_hdr;
+    ipv6_hdr_t *ipv6_hdr;
+
+    payload = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+    expect(payload != NULL);
+    udp = gnrc_pktbuf_add(payload, NULL, sizeof(udp_hdr_t), GNRC_NETTYPE_UNDEF);
+    expect(udp != NULL);
+    ipv6 = gnrc_pktbuf_add(udp, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    expect(ipv6 != NULL);
+    netif = gnrc_netif_hdr_build(NULL, 0, _dst_l2addr, sizeof(_dst_l2addr));
+    expect(netif != NULL);
+
+    udp_hdr = udp->data;
+    udp_hdr->src_port = byteorder_htons(port);
+    udp_hdr->dst_port = byteorder_htons(port);
+    udp_hdr->length = byteorder_htons(sizeof(udp_hdr_t) + size);
+    udp_hdr->checksum.u16 = 0;
+    ipv6_hdr = ipv6->data;
+    memset(ipv6_hdr, 0, sizeof(*ipv6_hdr));
+    ipv6_hdr_set_version(ipv6_hdr);
+    ipv6_hdr->len = byteorder_htons(sizeof(udp_hdr_t) + size);
+    ipv6_hdr->nh = PROTNUM_UDP;
+    ipv6_hdr->hl = 64;
+    ipv6_addr_set_link_local_prefix(&ipv6_hdr->src);
+    ipv6_hdr->src.u8[15] = 0x01;
+    ipv6_addr_set_link_local_prefix(&ipv6_hdr->dst);
+    ipv6_hdr->dst.u8[15] = 0x02;
+    return gnrc_pkt_prepend(ipv6, netif);
+}
+
+int main(void)
+{
+    gnrc_pktsnip_t *pkt;
+    netstats_fq_t *stats;
+    unsigned bulk_flow = 0, small_flow = 0, small = 0;
+
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_netdev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack),
+                                      GNRC_NETIF_PRIO, "pktq_fq_eth",
+                                      &_netdev.netdev.netdev) == 0);
+
+    printf("sending %u packets of bulk flow and %u packets of small flow\n",
+           BULK_NUMOF, SMALL_NUMOF);
+    /* the interface thread has a higher priority, so each packet is queued
+     * before gnrc_netapi_send() returns */
+    for (unsigned i = 0; i < PKTS_NUMOF; i++) {
+        bool is_bulk = (i < BULK_NUMOF);
+
+        pkt = _build(is_bulk ? BULK_PORT : SMALL_PORT,
+                     is_bulk ? BULK_SIZE : SMALL_SIZE);
+        if (is_bulk) {
+            bulk_flow = gnrc_netif_pktq_fq_flow(pkt);
+        }
+        else {
+            small_flow = gnrc_netif_pktq_fq_flow(pkt);
+        }
+        expect(gnrc_netapi_send(_netif.pid, pkt) == 1);
+    }
+    /* both flows need their own queue for this test */
+    expect(bulk_flow != small_flow);
+    /* the queued packets are sent on the dequeue timer from now on */
+    _busy = false;
+    mutex_lock(&_all_sent);
+
+    for (unsigned i = 0; i < PKTS_NUMOF; i++) {
+        if (_sent_ports[i] == SMALL_PORT) {
+            small++;
+            printf("packet %u of small flow sent as %u of %u\n", small, i + 1,
+                   PKTS_NUMOF);
+            /* at most the bulk packet at the head of the queue before */
+            expect(i <= small);
+        }
+    }
+    expect(small == SMALL_NUMOF);
+
+    expect(gnrc_netapi_get(_netif.pid, NETOPT_STATS, NETSTATS_PKTQ_FQ,
+                           &stats, sizeof(stats)) == sizeof(stats));
+    expect(stats[bulk_flow].enqueued == BULK_NUMOF);
+    expect(stats[bulk_flow].dequeued == BULK_NUMOF);
+    expect(stats[small_flow].enqueued == SMALL_NUMOF);
+    expect(stats[small_flow].dequeued == SMALL_NUMOF);
+    expect(stats[bulk_flow].dropped == 0);
+    expect(stats[small_flow].dropped == 0);
+    expect(stats[bulk_flow].backlog == 0);
+    expect(stats[small_flow].backlog == 0);
+    expect(gnrc_netif_pktq_usage() == 0);
+    puts("SUCCESS");
+
+    return 0;
+}
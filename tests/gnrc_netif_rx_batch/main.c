@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test of receive batching of a network interface
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/rx_batch.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+
+/* more than fit into one batch */
+#define FRAMES_NUMOF        (CONFIG_GNRC_NETIF_RX_BATCH_SIZE + 4U)
+#define TEST_PORT           (5683U)
+#define PKT_SIZE            (sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t) + 1)
+#define FRAME_SIZE          (sizeof(ethernet_hdr_t) + PKT_SIZE)
+
+static const uint8_t _l2addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _msg_queue[16];
+static unsigned _frames_recv;
+static unsigned _pkts_handled;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+/* UDP packet from fe80::1 to ff02::1 with the sequence number as payload */
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    ethernet_hdr_t *eth = (ethernet_hdr_t *)buf;
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)(eth + 1);
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    uint8_t *payload = (uint8_t *)(udp + 1);
+
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return FRAME_SIZE;
+    }
+    expect((unsigned)len >= FRAME_SIZE);
+    memset(buf, 0, FRAME_SIZE);
+    memcpy(eth->dst, _l2addr, sizeof(_l2addr));
+    eth->src[0] = 0x02;
+    eth->src[5] = 0x01;
+    eth->type = byteorder_htons(ETHERTYPE_IPV6);
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(sizeof(udp_hdr_t) + 1);
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 64;
+    ipv6_addr_set_link_local_prefix(&ipv6->src);
+    ipv6->src.u8[15] = 0x01;
+    ipv6_addr_set_all_nodes_multicast(&ipv6->dst, IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    udp->src_port = byteorder_htons(TEST_PORT);
+    udp->dst_port = byteorder_htons(TEST_PORT);
+    udp->length = byteorder_htons(sizeof(udp_hdr_t) + 1);
+    *payload = _frames_recv++;
+    return FRAME_SIZE;
+}
+
+static void _handle_pkt(gnrc_pktsnip_t *pkt)
+{
+    expect(pkt->type == GNRC_NETTYPE_IPV6);
+    expect(pkt->size == PKT_SIZE);
+    expect(((uint8_t *)pkt->data)[PKT_SIZE - 1] == _pkts_handled);
+    printf("received packet %u\n", _pkts_handled++);
+    gnrc_pktbuf_release(pkt);
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                         thread_getpid());
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    /* batches are only passed to the IPv6 thread, so this thread stands in
+     * for it */
+    gnrc_ipv6_pid = thread_getpid();
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &reg);
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_isr_cb(&_netdev, _isr);
+    netdev_test_set_recv_cb(&_netdev, _recv);
+    /* lower priority than main, so the frames are only handled once main
+     * waits for the packets */
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack),
+                                      THREAD_PRIORITY_MAIN + 1,
+                                      "rx_batch_eth",
+                                      &_netdev.netdev.netdev) == 0);
+
+    printf("sending %u frames\n", (unsigned)FRAMES_NUMOF);
+    for (unsigned i = 0; i < FRAMES_NUMOF; i++) {
+        netdev_trigger_event_isr(&_netdev.netdev.netdev);
+    }
+    while (_pkts_handled < FRAMES_NUMOF) {
+        unsigned expected = FRAMES_NUMOF - _pkts_handled;
+        msg_t msg;
+        gnrc_pktsnip_t *batch;
+
+        msg_receive(&msg);
+        /* every packet is part of a batch */
+        expect(msg.type != GNRC_NETAPI_MSG_TYPE_RCV);
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_RCV_BATCH) {
+            /* NIB timer event meant for the IPv6 thread */
+            continue;
+        }
+        /* the first batch is full, the second one holds the rest */
+        if (expected > CONFIG_GNRC_NETIF_RX_BATCH_SIZE) {
+            expected = CONFIG_GNRC_NETIF_RX_BATCH_SIZE;
+        }
+        batch = msg.content.ptr;
+        expect(batch->size == expected * sizeof(gnrc_pktsnip_t *));
+        printf("received batch of %u packets\n", expected);
+        gnrc_netif_rx_batch_handle(batch, _handle_pkt);
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
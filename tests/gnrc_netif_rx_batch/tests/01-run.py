@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT Developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+BATCH_SIZE = 8
+
+
+def testfunc(child):
+    child.expect(r"sending (\d+) frames")
+    numof = int(child.match.group(1))
+    i = 0
+    while i < numof:
+        child.expect(r"received batch of (\d+) packets")
+        batch = int(child.match.group(1))
+        assert batch == min(numof - i, BATCH_SIZE)
+        for _ in range(batch):
+            child.expect_exact("received packet {}".format(i))
+            i += 1
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
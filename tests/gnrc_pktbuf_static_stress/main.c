@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Replays allocation traces on the static packet buffer and
+ *              counts failed allocations
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "net/gnrc/pktbuf.h"
+#include "random.h"
+#include "test_utils/expect.h"
+
+#ifndef ALLOCS_NUMOF
+#define ALLOCS_NUMOF        (4000U)
+#endif
+
+#define SEED                (0x5eed)
+#define SLOTS_NUMOF         (16U)
+/* size of a netif header with two 8-byte addresses */
+#define NETIF_HDR_SIZE      (24U)
+#define MTU                 (1280U)
+#define IPV6_HDR_SIZE       (40U)
+#define UDP_HDR_SIZE        (8U)
+
+static gnrc_pktsnip_t *_slots[SLOTS_NUMOF];
+
+static gnrc_pktsnip_t *_lowpan_pkt(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          random_uint32_range(40, 128),
+                                          GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *hdr;
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    hdr = gnrc_pktbuf_add(pkt, NULL, NETIF_HDR_SIZE, GNRC_NETTYPE_UNDEF);
+    if (hdr == NULL) {
+        gnrc_pktbuf_release(pkt);
+    }
+    return hdr;
+}
+
+static gnrc_pktsnip_t *_mtu_pkt(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, MTU, GNRC_NETTYPE_UNDEF);
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    if ((gnrc_pktbuf_mark(pkt, IPV6_HDR_SIZE, GNRC_NETTYPE_UNDEF) == NULL) ||
+        (gnrc_pktbuf_mark(pkt, UDP_HDR_SIZE, GNRC_NETTYPE_UNDEF) == NULL)) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    return pkt;
+}
+
+static gnrc_pktsnip_t *_ctrl_pkt(void)
+{
+    return gnrc_pktbuf_add(NULL, NULL, random_uint32_range(8, 49),
+                           GNRC_NETTYPE_UNDEF);
+}
+
+static void _run(const char *name, bool mixed)
+{
+    unsigned failed = 0;
+
+    random_init(SEED);
+    for (unsigned i = 0; i < ALLOCS_NUMOF; i++) {
+        unsigned slot = random_uint32_range(0, SLOTS_NUMOF);
+        unsigned kind = mixed ? random_uint32_range(0, 8) : 7;
+        gnrc_pktsnip_t *pkt;
+
+        if (_slots[slot] != NULL) {
+            gnrc_pktbuf_release(_slots[slot]);
+            _slots[slot] = NULL;
+        }
+        if (kind < 2) {
+            pkt = _mtu_pkt();
+        }
+        else if (kind < 4) {
+            pkt = _ctrl_pkt();
+        }
+        else {
+            pkt = _lowpan_pkt();
+        }
+        if (pkt == NULL) {
+            failed++;
+        }
+        _slots[slot] = pkt;
+    }
+    for (unsigned i = 0; i < SLOTS_NUMOF; i++) {
+        if (_slots[i] != NULL) {
+            gnrc_pktbuf_release(_slots[i]);
+            _slots[i] = NULL;
+        }
+    }
+    printf("{ \"trace\" : \"%s\", \"size_classes\" : %u, \"allocs\" : %u, "
+           "\"failed\" : %u }\n", name,
+           (unsigned)CONFIG_GNRC_PKTBUF_SIZE_CLASSES, ALLOCS_NUMOF, failed);
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#endif
+    expect(gnrc_pktbuf_is_sane());
+    expect(gnrc_pktbuf_is_empty());
+}
+
+int main(void)
+{
+    _run("lowpan", false);
+    _run("mixed", true);
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Serves multiple GNRC TCP connections from a single event
+ *              thread over the IPv6 loopback address
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "event.h"
+#include "mutex.h"
+#include "net/af.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/tcp.h"
+#include "net/sock/async/event.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+
+#define SERVER_PORT         (8080U)
+#define CONNECTIONS         (2U)
+#define BUFFER_SIZE         (64U)
+#define TIMEOUT_US          (10U * US_PER_SEC)
+
+static char _ev_stack[THREAD_STACKSIZE_MAIN];
+static event_queue_t _ev_queue;
+static sock_tcp_queue_t _queue;
+static sock_tcp_t _server_socks[CONNECTIONS];
+static sock_tcp_t _client_socks[CONNECTIONS];
+static mutex_t _server_done = MUTEX_INIT_LOCKED;
+static unsigned _finished;
+static char _server_buf[BUFFER_SIZE];
+static char _client_buf[BUFFER_SIZE];
+
+static void _echo(sock_tcp_t *sock)
+{
+    ssize_t res;
+
+    while ((res = sock_tcp_read(sock, _server_buf, sizeof(_server_buf), 0)) > 0) {
+        expect(sock_tcp_write(sock, _server_buf, res) == res);
+        printf("Echoed %d bytes\n", (int)res);
+    }
+    expect((res == 0) || (res == -EAGAIN));
+}
+
+static void _sock_handler(sock_tcp_t *sock, sock_async_flags_t type, void *arg)
+{
+    (void)arg;
+    if (type & SOCK_ASYNC_MSG_RECV) {
+        _echo(sock);
+    }
+    if (type & SOCK_ASYNC_CONN_FIN) {
+        puts("Connection finished");
+        sock_tcp_disconnect(sock);
+        if (++_finished == CONNECTIONS) {
+            mutex_unlock(&_server_done);
+        }
+    }
+}
+
+static void _queue_handler(sock_tcp_queue_t *queue, sock_async_flags_t type,
+                           void *arg)
+{
+    sock_tcp_t *sock;
+
+    (void)arg;
+    if (!(type & SOCK_ASYNC_CONN_RECV)) {
+        return;
+    }
+    while (sock_tcp_accept(queue, &sock, 0) == 0) {
+        puts("Accepted connection");
+        sock_tcp_event_init(sock, &_ev_queue, _sock_handler, NULL);
+        /* data may have arrived before the handler was set */
+        _echo(sock);
+    }
+}
+
+static void *_ev_thread(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_ev_queue);
+    event_loop(&_ev_queue);
+    return NULL;
+}
+
+int main(void)
+{
+    sock_tcp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_tcp_ep_t remote = SOCK_IPV6_EP_ANY;
+    char msg[] = "hello from client 0";
+
+    event_queue_init_detached(&_ev_queue);
+    thread_create(_ev_stack, sizeof(_ev_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _ev_thread, NULL, "tcp_events");
+
+    local.port = SERVER_PORT;
+    expect(sock_tcp_listen(&_queue, &local, _server_socks, CONNECTIONS, 0) == 0);
+    sock_tcp_queue_event_init(&_queue, &_ev_queue, _queue_handler, NULL);
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+    remote.port = SERVER_PORT;
+    for (unsigned i = 0; i < CONNECTIONS; i++) {
+        expect(sock_tcp_connect(&_client_socks[i], &remote, 0, 0) == 0);
+    }
+    /* all connections are open at the same time */
+    for (unsigned i = 0; i < CONNECTIONS; i++) {
+        msg[sizeof(msg) - 2] = '0' + i;
+        expect(sock_tcp_write(&_client_socks[i], msg, sizeof(msg)) ==
+               (ssize_t)sizeof(msg));
+    }
+    for (unsigned i = 0; i < CONNECTIONS; i++) {
+        size_t received = 0;
+
+        msg[sizeof(msg) - 2] = '0' + i;
+        while (received < sizeof(msg)) {
+            ssize_t res = sock_tcp_read(&_client_socks[i], &_client_buf[received],
+                                        sizeof(_client_buf) - received, TIMEOUT_US);
+
+            expect(res > 0);
+            received += res;
+        }
+        expect(memcmp(_client_buf, msg, sizeof(msg)) == 0);
+    }
+    for (unsigned i = 0; i < CONNECTIONS; i++) {
+        sock_tcp_disconnect(&_client_socks[i]);
+    }
+    mutex_lock(&_server_done);
+    sock_tcp_stop_listen(&_queue);
+    puts("SUCCESS");
+
+    return 0;
+}
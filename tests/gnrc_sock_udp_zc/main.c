@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for gnrc_sock_udp_zc
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/af.h"
+#include "net/gnrc/netif/raw.h"
+#include "net/gnrc/sock_udp_zc.h"
+#include "net/ipv6/addr.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define NETIF_PRIO          (THREAD_PRIORITY_MAIN - 4)
+#define MAIN_QUEUE_SIZE     (8)
+#define TEST_PORT           (12345U)
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev_test;
+
+static const char _hdr[] = "telemetry";
+static uint8_t _data[256];
+
+static volatile unsigned _sends_completed;
+static volatile bool _zero_copy;
+static volatile unsigned _sends_on_completion;
+static mutex_t _completed = MUTEX_INIT_LOCKED;
+
+static bool _carries(const iolist_t *iolist, const void *chunk)
+{
+    for (; iolist != NULL; iolist = iolist->iol_next) {
+        if (iolist->iol_base == chunk) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    if (_carries(iolist, _hdr)) {
+        _zero_copy = _carries(iolist, _data);
+        /* give sock_udp_sendv_zc() time to return */
+        ztimer_sleep(ZTIMER_MSEC, 100);
+        _sends_completed++;
+    }
+    return iolist_size(iolist);
+}
+
+static int _netdev_get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _netdev_get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = 1500;
+    return sizeof(uint16_t);
+}
+
+static int _netdev_get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_IPV6;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _netdev_get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0x13, 0x37, 0xac, 0xdc, 0xbe, 0xef };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static void _sent(void *arg)
+{
+    (void)arg;
+    _sends_on_completion = _sends_completed;
+    mutex_unlock(&_completed);
+}
+
+int main(void)
+{
+    sock_udp_t sock;
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = TEST_PORT };
+    sock_udp_zc_t zc;
+    iolist_t data = { .iol_base = _data, .iol_len = sizeof(_data) };
+    iolist_t hdr = { .iol_next = &data, .iol_base = (void *)_hdr,
+                     .iol_len = sizeof(_hdr) };
+    ssize_t res;
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    netdev_test_setup(&_netdev_test, NULL);
+    netdev_test_set_send_cb(&_netdev_test, _netdev_send);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_DEVICE_TYPE,
+                           _netdev_get_device_type);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_MAX_PDU_SIZE,
+                           _netdev_get_max_pdu_size);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_PROTO, _netdev_get_proto);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_ADDRESS, _netdev_get_address);
+    expect(gnrc_netif_raw_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                 NETIF_PRIO, "netdev_test",
+                                 &_netdev_test.netdev.netdev) == 0);
+
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i;
+    }
+    ipv6_addr_set_all_nodes_multicast((ipv6_addr_t *)&remote.addr.ipv6,
+                                      IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+
+    res = sock_udp_sendv_zc(&sock, &hdr, &remote, &zc, _sent, NULL);
+    printf("sent %d bytes\n", (int)res);
+    expect(res == (ssize_t)(sizeof(_hdr) + sizeof(_data)));
+    /* the device is still busy with the payload */
+    expect(mutex_trylock(&_completed) == 0);
+    mutex_lock(&_completed);
+    printf("transmissions on completion = %u\n", _sends_on_completion);
+    expect(_sends_on_completion == 1);
+    expect(_zero_copy);
+    puts("payload transmitted without copy");
+
+    puts("TEST PASSED");
+
+    return 0;
+}
@@ -13,7 +13,7 @@ import socket
 import sys
 
 from scapy.all import Ether, IPv6, TCP, raw, \
-                      sendp
+                      sendp, srp1
 from testrunner import run
 
 from shared_func import sudo_guard, get_host_tap_device, get_host_ll_addr, \
@@ -147,6 +147,33 @@ def test_option_parsing_term(child, src_if, src_ll,
     verify_pktbuf_empty(child)
 
 
+@testfunc
+def test_option_negotiation(child, src_if, src_ll,
+                            dst_if, dst_l2, dst_ll, dst_port):
+    # window scale and SACK permitted offered in SYN are accepted in SYN+ACK
+    tcp_hdr = TCP(dport=dst_port, flags="S", sport=2342, seq=1,
+                  options=[('MSS', 1220), ('WScale', 7), ('SAckOK', b'')])
+    syn_ack = srp1(Ether(dst=dst_l2) / IPv6(src=src_ll, dst=dst_ll) / tcp_hdr,
+                   iface=src_if, verbose=0, timeout=child.timeout)
+    assert syn_ack is not None
+    options = dict(syn_ack[TCP].options)
+    assert 'WScale' in options
+    assert 'SAckOK' in options
+
+    sendp(Ether(dst=dst_l2) / IPv6(src=src_ll, dst=dst_ll) /
+          TCP(dport=dst_port, flags="R", sport=2342, seq=2),
+          iface=src_if, verbose=0)
+
+    # check if server actually still works
+    with socket.socket(socket.AF_INET6, socket.SOCK_STREAM) as sock:
+        sock.settimeout(child.timeout)
+        addr_info = socket.getaddrinfo(dst_ll + '%' + src_if, dst_port,
+                                       type=socket.SOCK_STREAM)
+        sock.connect(addr_info[0][-1])
+        child.expect_exact('gnrc_tcp_accept: returns 0')
+    verify_pktbuf_empty(child)
+
+
 if __name__ == "__main__":
     sudo_guard(uses_scapy=True)
     script = sys.modules[__name__]
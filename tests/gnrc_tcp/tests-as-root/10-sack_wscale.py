@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT Developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+from scapy.all import Ether, IPv6, TCP, ICMPv6ND_NS, ICMPv6NDOptSrcLLAddr, \
+                      get_if_hwaddr, sendp, sniff, srp1
+from testrunner import run
+
+from shared_func import sudo_guard, get_host_tap_device, get_riot_if_id, \
+                        get_riot_l2_addr, get_riot_ll_addr, \
+                        generate_port_number, setup_internal_buffer, \
+                        write_data_to_internal_buffer, verify_pktbuf_empty
+
+# The connections are driven by scapy. A source address unknown to the host
+# keeps its kernel from resetting them.
+SRC_ADDR = 'fe80::affe:1'
+SRC_PORT = 2342
+SRC_ISN = 1000
+SRC_MSS = 100
+SRC_WSCALE = 7
+
+
+def testfunc(func):
+    def runner(child):
+        tap = get_host_tap_device()
+        dst_if = get_riot_if_id(child)
+        dst_ll = get_riot_ll_addr(child)
+        dst_l2 = get_riot_l2_addr(child)
+        port = generate_port_number()
+
+        # Setup RIOT Node wait for incoming connections from host system
+        child.sendline('gnrc_tcp_tcb_init')
+        child.expect_exact('gnrc_tcp_tcb_init: argc=1, argv[0] = gnrc_tcp_tcb_init')
+        child.sendline('gnrc_tcp_listen [::]:{}'.format(port))
+        child.expect(r'gnrc_tcp_listen: argc=2, '
+                     r'argv\[0\] = gnrc_tcp_listen, '
+                     r'argv\[1\] = \[::\]:(\d+)\r\n')
+        assert int(child.match.group(1)) == port
+
+        child.sendline('gnrc_tcp_accept 15000')
+
+        try:
+            print("- {} ".format(func.__name__), end="")
+            if child.logfile == sys.stdout:
+                func(child, tap, dst_if, dst_l2, dst_ll, port)
+                print("")
+            else:
+                try:
+                    func(child, tap, dst_if, dst_l2, dst_ll, port)
+                    print("SUCCESS")
+                except Exception as e:
+                    print("FAILED")
+                    raise e
+        finally:
+            child.sendline('gnrc_tcp_close')
+            child.sendline('gnrc_tcp_stop_listen')
+
+    return runner
+
+
+def tcp_from_riot(port):
+    return lambda pkt: (TCP in pkt and pkt[TCP].sport == port and
+                        pkt[TCP].dport == SRC_PORT)
+
+
+def send_and_sniff(child, src_if, pkt, port, count=1):
+    res = sniff(iface=src_if, lfilter=tcp_from_riot(port), count=count,
+                timeout=child.timeout,
+                started_callback=lambda: sendp(pkt, iface=src_if, verbose=0))
+    assert len(res) == count
+    return res
+
+
+def connect(child, src_if, dst_l2, dst_ll, dst_port, options, window=8192):
+    # Make RIOT resolve the link layer address of the source address
+    sendp(Ether(dst=dst_l2) / IPv6(src=SRC_ADDR, dst=dst_ll, hlim=255) /
+          ICMPv6ND_NS(tgt=dst_ll) / ICMPv6NDOptSrcLLAddr(lladdr=get_if_hwaddr(src_if)),
+          iface=src_if, verbose=0)
+
+    syn_ack = srp1(Ether(dst=dst_l2) / IPv6(src=SRC_ADDR, dst=dst_ll) /
+                   TCP(dport=dst_port, flags="S", sport=SRC_PORT, seq=SRC_ISN,
+                       window=window, options=options),
+                   iface=src_if, verbose=0, timeout=child.timeout)
+    assert syn_ack is not None
+    assert syn_ack[TCP].flags == "SA"
+    assert syn_ack[TCP].ack == SRC_ISN + 1
+
+    sendp(Ether(dst=dst_l2) / IPv6(src=SRC_ADDR, dst=dst_ll) /
+          TCP(dport=dst_port, flags="A", sport=SRC_PORT, seq=SRC_ISN + 1,
+              ack=syn_ack[TCP].seq + 1, window=window),
+          iface=src_if, verbose=0)
+    child.expect_exact('gnrc_tcp_accept: returns 0')
+    return syn_ack
+
+
+def reset(src_if, dst_l2, dst_ll, dst_port, seq):
+    sendp(Ether(dst=dst_l2) / IPv6(src=SRC_ADDR, dst=dst_ll) /
+          TCP(dport=dst_port, flags="R", sport=SRC_PORT, seq=seq),
+          iface=src_if, verbose=0)
+
+
+@testfunc
+def test_sack_generation(child, src_if, dst_if, dst_l2, dst_ll, dst_port):
+    syn_ack = connect(child, src_if, dst_l2, dst_ll, dst_port,
+                      [('MSS', SRC_MSS), ('SAckOK', b'')])
+    assert 'SAckOK' in dict(syn_ack[TCP].options)
+    ack = syn_ack[TCP].seq + 1
+
+    # Data behind a gap is acknowledged up to the gap and reported as SACK block
+    res = send_and_sniff(child, src_if,
+                         Ether(dst=dst_l2) / IPv6(src=SRC_ADDR, dst=dst_ll) /
+                         TCP(dport=dst_port, flags="PA", sport=SRC_PORT,
+                             seq=SRC_ISN + 5, ack=ack) / (b'x' * 8), dst_port)
+    assert res[0][TCP].ack == SRC_ISN + 1
+    assert dict(res[0][TCP].options).get('SAck') == (SRC_ISN + 5, SRC_ISN + 13)
+
+    # Filling the gap acknowledges everything, no SACK block is left
+    res = send_and_sniff(child, src_if,
+                         Ether(dst=dst_l2) / IPv6(src=SRC_ADDR, dst=dst_ll) /
+                         TCP(dport=dst_port, flags="PA", sport=SRC_PORT,
+                             seq=SRC_ISN + 1, ack=ack) / (b'x' * 4), dst_port)
+    assert res[0][TCP].ack == SRC_ISN + 13
+    assert 'SAck' not in dict(res[0][TCP].options)
+    reset(src_if, dst_l2, dst_ll, dst_port, SRC_ISN + 13)
+    verify_pktbuf_empty(child)
+
+
+@testfunc
+def test_sack_retransmission(child, src_if, dst_if, dst_l2, dst_ll, dst_port):
+    syn_ack = connect(child, src_if, dst_l2, dst_ll, dst_port,
+                      [('MSS', SRC_MSS), ('SAckOK', b'')])
+    assert 'SAckOK' in dict(syn_ack[TCP].options)
+    snd = syn_ack[TCP].seq + 1
+    ack = SRC_ISN + 1
+
+    data = '0123456789' * 30
+    assert setup_internal_buffer(child) >= len(data)
+    write_data_to_internal_buffer(child, data)
+
+    # RIOT sends three full sized segments
+    res = sniff(iface=src_if, lfilter=tcp_from_riot(dst_port), count=3,
+                timeout=child.timeout,
+                started_callback=lambda: child.sendline('gnrc_tcp_send 0'))
+    assert [pkt[TCP].seq for pkt in res] == [snd, snd + 100, snd + 200]
+    child.expect_exact('gnrc_tcp_send: sent ' + str(len(data)))
+
+    # The second segment is lost: the hole is retransmitted before the
+    # retransmission timer (at least one second) expires
+    res = sniff(iface=src_if, lfilter=tcp_from_riot(dst_port), count=1,
+                timeout=0.5,
+                started_callback=lambda: sendp(
+                    Ether(dst=dst_l2) / IPv6(src=SRC_ADDR, dst=dst_ll) /
+                    TCP(dport=dst_port, flags="A", sport=SRC_PORT, seq=ack,
+                        ack=snd + 100, options=[('SAck', (snd + 200, snd + 300))]),
+                    iface=src_if, verbose=0))
+    assert len(res) == 1
+    assert res[0][TCP].seq == snd + 100
+    assert len(res[0][TCP].payload) == 100
+
+    sendp(Ether(dst=dst_l2) / IPv6(src=SRC_ADDR, dst=dst_ll) /
+          TCP(dport=dst_port, flags="A", sport=SRC_PORT, seq=ack, ack=snd + 300),
+          iface=src_if, verbose=0)
+    reset(src_if, dst_l2, dst_ll, dst_port, ack)
+    verify_pktbuf_empty(child)
+
+
+@testfunc
+def test_wnd_scale_acceptance(child, src_if, dst_if, dst_l2, dst_ll, dst_port):
+    # The window field of 8 announces 1024 byte once scaled
+    syn_ack = connect(child, src_if, dst_l2, dst_ll, dst_port,
+                      [('MSS', SRC_MSS), ('WScale', SRC_WSCALE)], window=8)
+    assert 'WScale' in dict(syn_ack[TCP].options)
+    snd = syn_ack[TCP].seq + 1
+
+    data = '0123456789' * 30
+    assert setup_internal_buffer(child) >= len(data)
+    write_data_to_internal_buffer(child, data)
+
+    res = sniff(iface=src_if, lfilter=tcp_from_riot(dst_port), count=3,
+                timeout=child.timeout,
+                started_callback=lambda: child.sendline('gnrc_tcp_send 0'))
+    assert len(res) == 3
+    assert all(len(pkt[TCP].payload) == SRC_MSS for pkt in res)
+    child.expect_exact('gnrc_tcp_send: sent ' + str(len(data)))
+
+    sendp(Ether(dst=dst_l2) / IPv6(src=SRC_ADDR, dst=dst_ll) /
+          TCP(dport=dst_port, flags="A", sport=SRC_PORT, seq=SRC_ISN + 1,
+              ack=snd + 300, window=8),
+          iface=src_if, verbose=0)
+    reset(src_if, dst_l2, dst_ll, dst_port, SRC_ISN + 1)
+    verify_pktbuf_empty(child)
+
+
+@testfunc
+def test_wnd_scale_advertisement(child, src_if, dst_if, dst_l2, dst_ll, dst_port):
+    syn_ack = connect(child, src_if, dst_l2, dst_ll, dst_port,
+                      [('MSS', SRC_MSS), ('WScale', SRC_WSCALE)])
+    options = dict(syn_ack[TCP].options)
+    assert 'WScale' in options
+    shift = options['WScale']
+
+    # The window of the SYN+ACK is unscaled, later windows are scaled down
+    res = send_and_sniff(child, src_if,
+                         Ether(dst=dst_l2) / IPv6(src=SRC_ADDR, dst=dst_ll) /
+                         TCP(dport=dst_port, flags="PA", sport=SRC_PORT,
+                             seq=SRC_ISN + 1, ack=syn_ack[TCP].seq + 1) / (b'x' * 8),
+                         dst_port)
+    assert res[0][TCP].ack == SRC_ISN + 9
+    assert res[0][TCP].window == (syn_ack[TCP].window - 8) >> shift
+    reset(src_if, dst_l2, dst_ll, dst_port, SRC_ISN + 9)
+    verify_pktbuf_empty(child)
+
+
+if __name__ == "__main__":
+    sudo_guard(uses_scapy=True)
+    script = sys.modules[__name__]
+    tests = [getattr(script, t) for t in script.__dict__
+             if type(getattr(script, t)).__name__ == "function"
+             and t.startswith("test_")]
+    for test in tests:
+        res = run(test, timeout=10, echo=False)
+        if res != 0:
+            sys.exit(res)
+    print(os.path.basename(sys.argv[0]) + ": success\n")
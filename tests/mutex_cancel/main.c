@@ -28,6 +28,19 @@
 
 static mutex_t testlock = MUTEX_INIT;
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+static mutex_t pi_lock = MUTEX_INIT;
+static char owner_stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *owner_thread(void *arg)
+{
+    (void)arg;
+    mutex_lock(&pi_lock);
+    thread_sleep();
+    return NULL;
+}
+#endif
+
 static void cb_unlock(void *mutex)
 {
     mutex_unlock(mutex);
@@ -73,6 +86,23 @@ int main(void)
     expect(mutex_lock_cancelable(&mc) == -ECANCELED);
     puts("OK");
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    printf("%s: ", "Test cancellation drops inherited priority");
+    kernel_pid_t owner = thread_create(owner_stack, sizeof(owner_stack),
+                                       THREAD_PRIORITY_MAIN + 1,
+                                       THREAD_CREATE_STACKTEST,
+                                       owner_thread, NULL, "owner");
+    /* let the owner lock the mutex */
+    xtimer_usleep(US_PER_MS);
+    mc = mutex_cancel_init(&pi_lock);
+    xt.callback = cb_cancel;
+    xt.arg = &mc;
+    xtimer_set(&xt, US_PER_MS * 10);
+    expect(mutex_lock_cancelable(&mc) == -ECANCELED);
+    expect(thread_get(owner)->priority == THREAD_PRIORITY_MAIN + 1);
+    puts("OK");
+#endif
+
     puts("TEST PASSED");
 
     return 0;
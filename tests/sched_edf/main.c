@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test for the earliest deadline first scheduling class
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "ps.h"
+#include "sched_edf.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef PERIOD_US
+#define PERIOD_US       (10000U)
+#endif
+
+#ifndef JOB_US
+#define JOB_US          (1000U)
+#endif
+
+#ifndef JOBS_NUMOF
+#define JOBS_NUMOF      (50U)
+#endif
+
+#define WORKER_PRIO     (THREAD_PRIORITY_MAIN + 1)
+
+static char _hog_stack[THREAD_STACKSIZE_DEFAULT];
+static char _control_stack[THREAD_STACKSIZE_DEFAULT];
+
+static volatile unsigned _jobs;
+
+static void *_hog(void *arg)
+{
+    (void)arg;
+
+    while (1) {}
+
+    return NULL;
+}
+
+static void *_control(void *arg)
+{
+    (void)arg;
+    uint32_t last_release = ztimer_now(ZTIMER_USEC);
+
+    while (_jobs < JOBS_NUMOF) {
+        thread_periodic_release(&last_release, PERIOD_US);
+        ztimer_spin(ZTIMER_USEC, JOB_US);
+        _jobs++;
+    }
+
+    /* exits with the deadline of the last job still armed */
+    return NULL;
+}
+
+int main(void)
+{
+    puts("START");
+
+    kernel_pid_t control = thread_create(_control_stack,
+                                         sizeof(_control_stack), WORKER_PRIO,
+                                         THREAD_CREATE_STACKTEST, _control,
+                                         NULL, "control");
+    thread_create(_hog_stack, sizeof(_hog_stack), WORKER_PRIO,
+                  THREAD_CREATE_STACKTEST, _hog, NULL, "hog");
+
+    ztimer_sleep(ZTIMER_USEC, (JOBS_NUMOF + 2) * PERIOD_US);
+
+    unsigned missed = thread_missed_deadlines(control);
+    printf("jobs: %u, missed deadlines: %u\n", _jobs, missed);
+    ps();
+
+    if ((_jobs == JOBS_NUMOF) && (missed == 0)) {
+        puts("SUCCESS");
+    }
+    else {
+        puts("FAILURE");
+    }
+
+    return 0;
+}
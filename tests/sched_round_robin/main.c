@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test for round robin time slicing
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "sched_round_robin.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define THREADS_NUMOF   (3U)
+#define TEST_SLICES     (20U)
+
+static char _stacks[THREADS_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static volatile uint32_t _counters[THREADS_NUMOF];
+
+static void *_busy(void *arg)
+{
+    volatile uint32_t *counter = arg;
+
+    while (1) {
+        (*counter)++;
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("START");
+
+    for (unsigned i = 0; i < THREADS_NUMOF; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN + 1,
+                      THREAD_CREATE_STACKTEST, _busy, (void *)&_counters[i],
+                      "busy");
+    }
+
+    ztimer_sleep(ZTIMER_USEC, TEST_SLICES * CONFIG_SCHED_RR_QUANTUM_US);
+
+    unsigned ran = 0;
+    for (unsigned i = 0; i < THREADS_NUMOF; i++) {
+        printf("thread %u: %" PRIu32 "\n", i, _counters[i]);
+        if (_counters[i] > 0) {
+            ran++;
+        }
+    }
+
+    puts((ran == THREADS_NUMOF) ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
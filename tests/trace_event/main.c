@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       trace_event module test application
+ *
+ * A worker thread is woken up by a message, by a mutex hand-over and by
+ * thread flags, so that each kind of event gets recorded at least once.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "trace_event.h"
+
+#define TEST_MSG_TYPE       (0x4242)
+#define TEST_FLAG           (0x1)
+#define TEST_USER_VAL       (0xc0ffee)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _mutex = MUTEX_INIT_LOCKED;
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    msg_receive(&m);
+    mutex_lock(&_mutex);
+    mutex_unlock(&_mutex);
+    thread_flags_wait_any(TEST_FLAG);
+
+    return NULL;
+}
+
+int main(void)
+{
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _worker, NULL, "worker");
+    msg_t m = { .type = TEST_MSG_TYPE };
+
+    msg_send(&m, pid);
+    mutex_unlock(&_mutex);
+    thread_flags_set(thread_get(pid), TEST_FLAG);
+    trace_event_user(TEST_USER_VAL);
+
+    trace_event_dump();
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT Developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+SCHED_SWITCH = 1
+MSG_SEND = 2
+MSG_RECV = 3
+MUTEX_BLOCK = 4
+MUTEX_UNBLOCK = 5
+THREAD_FLAGS_SET = 6
+THREAD_FLAGS_WAIT = 7
+USER = 10
+
+
+def testfunc(child):
+    child.expect(r"trace_event: version=2 events=(\d+) lost=0 isr_pid=\d+ "
+                 r"freq=(\d+) width=(\d+)\r\n")
+    width = int(child.match.group(3))
+    child.expect(r"trace_event: thread (\d+) (main|-)\r\n")
+    main_pid = int(child.match.group(1))
+    child.expect(r"trace_event: thread (\d+) (worker|-)\r\n")
+    worker_pid = int(child.match.group(1))
+
+    events = []
+    while True:
+        child.expect(r"trace_event: (end|([0-9a-f]{8}) ([0-9a-f]{2}) "
+                     r"([0-9a-f]{2}) ([0-9a-f]{4}) ([0-9a-f]{8}))\r\n")
+        if child.match.group(1) == "end":
+            break
+        events.append(tuple(int(g, 16) for g in child.match.groups()[1:]))
+
+    found = set((etype, pid, arg) for _, etype, _, pid, arg in events)
+    assert (MSG_SEND, worker_pid, 0x4242) in found
+    assert (MSG_RECV, main_pid, 0x4242) in found
+    assert (SCHED_SWITCH, worker_pid, main_pid) in found
+    assert (SCHED_SWITCH, main_pid, worker_pid) in found
+    assert (THREAD_FLAGS_WAIT, worker_pid, 0x1) in found
+    assert (THREAD_FLAGS_SET, worker_pid, 0x1) in found
+    assert (USER, main_pid, 0xc0ffee) in found
+    assert any(e[1] == MUTEX_BLOCK and e[3] == worker_pid for e in events)
+    assert any(e[1] == MUTEX_UNBLOCK and e[3] == worker_pid for e in events)
+
+    # the raw timer may wrap, but never goes back by more than half a period
+    times = [e[0] for e in events]
+    for prev, cur in zip(times, times[1:]):
+        assert (cur - prev) % (1 << width) < (1 << (width - 1))
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "congure/cubic.h"
+#include "congure/reno.h"
+
+#include "tests-congure.h"
+
+#define TEST_MSS            (1000U)
+#define TEST_INIT_WND       (4U * TEST_MSS)
+#define TEST_RTT            (100U)
+/* time in ms for CUBIC to grow back from 0.7 * 10 * TEST_MSS to
+ * 10 * TEST_MSS: cbrt(0.3 * 10 / 0.4) s */
+#define TEST_CUBIC_K        (1957U)
+
+static congure_reno_snd_t _reno;
+static congure_cubic_snd_t _cubic;
+static congure_snd_msg_t _msg;
+static congure_snd_ack_t _ack;
+
+static void set_up(void)
+{
+    memset(&_reno, 0, sizeof(_reno));
+    memset(&_cubic, 0, sizeof(_cubic));
+    memset(&_msg, 0, sizeof(_msg));
+    memset(&_ack, 0, sizeof(_ack));
+    _msg.super.next = &_msg.super;
+    _msg.size = TEST_MSS;
+    congure_reno_snd_setup(&_reno, TEST_MSS);
+    _reno.super.driver->init(&_reno.super, &_reno);
+    congure_cubic_snd_setup(&_cubic, TEST_MSS);
+    _cubic.super.super.driver->init(&_cubic.super.super, &_cubic);
+}
+
+static void _send(congure_snd_t *c, unsigned num)
+{
+    for (unsigned i = 0; i < num; i++) {
+        c->driver->report_msg_sent(c, TEST_MSS);
+    }
+}
+
+static void _ack_at(congure_snd_t *c, ztimer_now_t recv_time)
+{
+    _msg.send_time = recv_time - TEST_RTT;
+    _ack.recv_time = recv_time;
+    c->driver->report_msg_acked(c, &_msg, &_ack);
+}
+
+static void test_reno_init_wnd(void)
+{
+    TEST_ASSERT_EQUAL_INT(4 * 500, congure_reno_snd_init_wnd(500));
+    TEST_ASSERT_EQUAL_INT(4 * 1095, congure_reno_snd_init_wnd(1095));
+    TEST_ASSERT_EQUAL_INT(3 * 1096, congure_reno_snd_init_wnd(1096));
+    TEST_ASSERT_EQUAL_INT(3 * 2190, congure_reno_snd_init_wnd(2190));
+    TEST_ASSERT_EQUAL_INT(2 * 2191, congure_reno_snd_init_wnd(2191));
+    TEST_ASSERT_EQUAL_INT(CONGURE_WND_SIZE_MAX,
+                          congure_reno_snd_init_wnd(CONGURE_WND_SIZE_MAX));
+}
+
+static void test_reno_init(void)
+{
+    TEST_ASSERT(_reno.super.ctx == &_reno);
+    TEST_ASSERT_EQUAL_INT(TEST_INIT_WND, _reno.super.cwnd);
+    TEST_ASSERT_EQUAL_INT(CONGURE_WND_SIZE_MAX, _reno.ssthresh);
+    TEST_ASSERT_EQUAL_INT(0, _reno.in_flight_size);
+    TEST_ASSERT_EQUAL_INT(-1, _reno.super.driver->inter_msg_interval(&_reno.super,
+                                                                     TEST_MSS));
+}
+
+static void test_reno_sent_discarded(void)
+{
+    _send(&_reno.super, 2);
+    TEST_ASSERT_EQUAL_INT(2 * TEST_MSS, _reno.in_flight_size);
+    _reno.super.driver->report_msg_discarded(&_reno.super, TEST_MSS);
+    TEST_ASSERT_EQUAL_INT(TEST_MSS, _reno.in_flight_size);
+    _reno.super.driver->report_msg_discarded(&_reno.super, 2 * TEST_MSS);
+    TEST_ASSERT_EQUAL_INT(0, _reno.in_flight_size);
+}
+
+static void test_reno_slow_start(void)
+{
+    _send(&_reno.super, 4);
+    _ack_at(&_reno.super, TEST_RTT);
+    TEST_ASSERT_EQUAL_INT(TEST_INIT_WND + TEST_MSS, _reno.super.cwnd);
+    TEST_ASSERT_EQUAL_INT(3 * TEST_MSS, _reno.in_flight_size);
+    /* at most one MSS per ACK */
+    _msg.size = 2 * TEST_MSS;
+    _ack_at(&_reno.super, TEST_RTT);
+    TEST_ASSERT_EQUAL_INT(TEST_INIT_WND + (2 * TEST_MSS), _reno.super.cwnd);
+    TEST_ASSERT_EQUAL_INT(TEST_MSS, _reno.in_flight_size);
+}
+
+static void test_reno_slow_start__saturate(void)
+{
+    _reno.super.cwnd = CONGURE_WND_SIZE_MAX - (TEST_MSS / 2);
+    _ack_at(&_reno.super, TEST_RTT);
+    TEST_ASSERT_EQUAL_INT(CONGURE_WND_SIZE_MAX, _reno.super.cwnd);
+}
+
+static void test_reno_lost(void)
+{
+    _send(&_reno.super, 8);
+    _reno.super.driver->report_msgs_lost(&_reno.super, &_msg);
+    TEST_ASSERT_EQUAL_INT(4 * TEST_MSS, _reno.ssthresh);
+    TEST_ASSERT_EQUAL_INT(4 * TEST_MSS, _reno.super.cwnd);
+    /* lost messages are still in flight until they are acknowledged */
+    TEST_ASSERT_EQUAL_INT(8 * TEST_MSS, _reno.in_flight_size);
+}
+
+static void test_reno_lost__min_ssthresh(void)
+{
+    _send(&_reno.super, 1);
+    _reno.super.driver->report_msgs_lost(&_reno.super, &_msg);
+    TEST_ASSERT_EQUAL_INT(2 * TEST_MSS, _reno.ssthresh);
+    TEST_ASSERT_EQUAL_INT(2 * TEST_MSS, _reno.super.cwnd);
+}
+
+static void test_reno_timeout(void)
+{
+    _send(&_reno.super, 6);
+    _reno.super.driver->report_msgs_timeout(&_reno.super, &_msg);
+    TEST_ASSERT_EQUAL_INT(3 * TEST_MSS, _reno.ssthresh);
+    TEST_ASSERT_EQUAL_INT(TEST_MSS, _reno.super.cwnd);
+}
+
+static void test_reno_ecn_ce(void)
+{
+    _send(&_reno.super, 8);
+    _reno.super.driver->report_ecn_ce(&_reno.super, 0);
+    TEST_ASSERT_EQUAL_INT(4 * TEST_MSS, _reno.ssthresh);
+    TEST_ASSERT_EQUAL_INT(4 * TEST_MSS, _reno.super.cwnd);
+}
+
+static void test_reno_congestion_avoidance(void)
+{
+    _send(&_reno.super, 8);
+    _reno.super.driver->report_msgs_lost(&_reno.super, &_msg);
+    _ack_at(&_reno.super, TEST_RTT);
+    /* MSS * MSS / cwnd */
+    TEST_ASSERT_EQUAL_INT((4 * TEST_MSS) + (TEST_MSS / 4), _reno.super.cwnd);
+    TEST_ASSERT_EQUAL_INT(7 * TEST_MSS, _reno.in_flight_size);
+}
+
+static void test_cubic_init(void)
+{
+    TEST_ASSERT(_cubic.super.super.ctx == &_cubic);
+    TEST_ASSERT_EQUAL_INT(TEST_INIT_WND, _cubic.super.super.cwnd);
+    TEST_ASSERT_EQUAL_INT(CONGURE_WND_SIZE_MAX, _cubic.super.ssthresh);
+    TEST_ASSERT_EQUAL_INT(0, _cubic.super.in_flight_size);
+    TEST_ASSERT_EQUAL_INT(0, _cubic.epoch_start);
+    TEST_ASSERT_EQUAL_INT(-1, _cubic.super.super.driver->inter_msg_interval(
+                              &_cubic.super.super, TEST_MSS));
+}
+
+static void test_cubic_slow_start(void)
+{
+    _send(&_cubic.super.super, 4);
+    _ack_at(&_cubic.super.super, TEST_RTT);
+    TEST_ASSERT_EQUAL_INT(TEST_INIT_WND + TEST_MSS, _cubic.super.super.cwnd);
+    TEST_ASSERT_EQUAL_INT(3 * TEST_MSS, _cubic.super.in_flight_size);
+    TEST_ASSERT_EQUAL_INT(TEST_RTT, _cubic.rtt_min);
+    TEST_ASSERT_EQUAL_INT(0, _cubic.epoch_start);
+}
+
+static void test_cubic_lost(void)
+{
+    _cubic.super.super.cwnd = 10 * TEST_MSS;
+    _cubic.super.super.driver->report_msgs_lost(&_cubic.super.super, &_msg);
+    TEST_ASSERT_EQUAL_INT(7 * TEST_MSS, _cubic.super.ssthresh);
+    TEST_ASSERT_EQUAL_INT(7 * TEST_MSS, _cubic.super.super.cwnd);
+    TEST_ASSERT_EQUAL_INT(10 * TEST_MSS, _cubic.w_max);
+    TEST_ASSERT_EQUAL_INT(10 * TEST_MSS, _cubic.w_last_max);
+}
+
+static void test_cubic_lost__fast_convergence(void)
+{
+    _cubic.super.super.cwnd = 10 * TEST_MSS;
+    _cubic.super.super.driver->report_msgs_lost(&_cubic.super.super, &_msg);
+    _cubic.super.super.cwnd = 8 * TEST_MSS;
+    _cubic.super.super.driver->report_msgs_lost(&_cubic.super.super, &_msg);
+    /* (1 + beta) / 2 * cwnd */
+    TEST_ASSERT_EQUAL_INT(6800, _cubic.w_max);
+    TEST_ASSERT_EQUAL_INT(8 * TEST_MSS, _cubic.w_last_max);
+    TEST_ASSERT_EQUAL_INT(5600, _cubic.super.ssthresh);
+    TEST_ASSERT_EQUAL_INT(5600, _cubic.super.super.cwnd);
+}
+
+static void test_cubic_lost__min_ssthresh(void)
+{
+    _cubic.super.super.cwnd = 2 * TEST_MSS;
+    _cubic.super.super.driver->report_msgs_lost(&_cubic.super.super, &_msg);
+    TEST_ASSERT_EQUAL_INT(2 * TEST_MSS, _cubic.super.ssthresh);
+}
+
+static void test_cubic_timeout(void)
+{
+    _cubic.super.super.cwnd = 10 * TEST_MSS;
+    _cubic.super.super.driver->report_msgs_timeout(&_cubic.super.super, &_msg);
+    TEST_ASSERT_EQUAL_INT(7 * TEST_MSS, _cubic.super.ssthresh);
+    TEST_ASSERT_EQUAL_INT(TEST_MSS, _cubic.super.super.cwnd);
+}
+
+static void test_cubic_ecn_ce(void)
+{
+    _cubic.super.super.cwnd = 10 * TEST_MSS;
+    _cubic.super.super.driver->report_ecn_ce(&_cubic.super.super, 0);
+    TEST_ASSERT_EQUAL_INT(7 * TEST_MSS, _cubic.super.super.cwnd);
+}
+
+static void test_cubic_congestion_avoidance(void)
+{
+    const ztimer_now_t start = 1000;
+    congure_wnd_size_t cwnd;
+
+    _cubic.super.super.cwnd = 10 * TEST_MSS;
+    _cubic.super.super.driver->report_msgs_lost(&_cubic.super.super, &_msg);
+
+    /* first ACK starts the epoch, growth is TCP-friendly at its start */
+    _ack_at(&_cubic.super.super, start);
+    TEST_ASSERT_EQUAL_INT(start, _cubic.epoch_start);
+    TEST_ASSERT_EQUAL_INT(TEST_CUBIC_K, _cubic.k);
+    TEST_ASSERT_EQUAL_INT(TEST_RTT, _cubic.rtt_min);
+    /* alpha * MSS * MSS / cwnd */
+    TEST_ASSERT_EQUAL_INT((7 * TEST_MSS) + 75, _cubic.super.super.cwnd);
+
+    /* concave region: grows towards, but not beyond, w_max */
+    for (ztimer_now_t t = start; t < (start + TEST_CUBIC_K - TEST_RTT);
+         t += TEST_RTT) {
+        cwnd = _cubic.super.super.cwnd;
+        _ack_at(&_cubic.super.super, t);
+        TEST_ASSERT(_cubic.super.super.cwnd >= cwnd);
+        TEST_ASSERT(_cubic.super.super.cwnd <= _cubic.w_max);
+    }
+
+    /* convex region: at most 1.5 * cwnd per round-trip time */
+    cwnd = _cubic.super.super.cwnd;
+    _ack_at(&_cubic.super.super, start + (20 * TEST_CUBIC_K));
+    TEST_ASSERT_EQUAL_INT(cwnd + (((cwnd / 2) * TEST_MSS) / cwnd),
+                          _cubic.super.super.cwnd);
+}
+
+static void test_cubic_rtt_min__resent(void)
+{
+    _msg.resends = 1;
+    _ack_at(&_cubic.super.super, TEST_RTT);
+    TEST_ASSERT_EQUAL_INT(0, _cubic.rtt_min);
+}
+
+static Test *tests_congure_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_reno_init_wnd),
+        new_TestFixture(test_reno_init),
+        new_TestFixture(test_reno_sent_discarded),
+        new_TestFixture(test_reno_slow_start),
+        new_TestFixture(test_reno_slow_start__saturate),
+        new_TestFixture(test_reno_lost),
+        new_TestFixture(test_reno_lost__min_ssthresh),
+        new_TestFixture(test_reno_timeout),
+        new_TestFixture(test_reno_ecn_ce),
+        new_TestFixture(test_reno_congestion_avoidance),
+        new_TestFixture(test_cubic_init),
+        new_TestFixture(test_cubic_slow_start),
+        new_TestFixture(test_cubic_lost),
+        new_TestFixture(test_cubic_lost__fast_convergence),
+        new_TestFixture(test_cubic_lost__min_ssthresh),
+        new_TestFixture(test_cubic_timeout),
+        new_TestFixture(test_cubic_ecn_ce),
+        new_TestFixture(test_cubic_congestion_avoidance),
+        new_TestFixture(test_cubic_rtt_min__resent),
+    };
+
+    EMB_UNIT_TESTCALLER(congure_tests, set_up, NULL, fixtures);
+
+    return (Test *)&congure_tests;
+}
+
+void tests_congure(void)
+{
+    TESTS_RUN(tests_congure_tests());
+}
+/** @} */
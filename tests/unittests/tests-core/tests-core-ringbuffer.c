@@ -16,6 +16,8 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <string.h>
+
 #include "thread.h"
 #include "ringbuffer.h"
 #include "mutex.h"
@@ -152,12 +154,66 @@ static void tests_core_ringbuffer_remove_underflow(void)
     TEST_ASSERT_EQUAL_INT(1, ringbuffer_empty(&buf));
 }
 
+static void tests_core_ringbuffer_add_wrap(void)
+{
+    char mem[5];
+    char out[5];
+    ringbuffer_t buf;
+    ringbuffer_init(&buf, mem, sizeof(mem));
+
+    TEST_ASSERT_EQUAL_INT(3, ringbuffer_add(&buf, "abc", 3));
+    TEST_ASSERT_EQUAL_INT(2, ringbuffer_get(&buf, out, 2));
+    /* wraps around the end of mem, only four elements fit */
+    TEST_ASSERT_EQUAL_INT(4, ringbuffer_add(&buf, "defgh", 5));
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_full(&buf));
+    TEST_ASSERT_EQUAL_INT(5, ringbuffer_get(&buf, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "cdefg", 5));
+}
+
+static void tests_core_ringbuffer_spans(void)
+{
+    char mem[5];
+    char *wr;
+    const char *rd;
+    ringbuffer_t buf;
+    ringbuffer_init(&buf, mem, sizeof(mem));
+
+    TEST_ASSERT_EQUAL_INT(5, ringbuffer_get_write_span(&buf, &wr));
+    TEST_ASSERT(wr == mem);
+    memcpy(wr, "abcd", 4);
+    ringbuffer_commit(&buf, 4);
+    TEST_ASSERT_EQUAL_INT(4, ringbuffer_peek_read_span(&buf, &rd));
+    TEST_ASSERT(rd == mem);
+    ringbuffer_remove(&buf, 3);
+
+    /* free space is split in [4] and [0..2] */
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_get_write_span(&buf, &wr));
+    *wr = 'e';
+    ringbuffer_commit(&buf, 1);
+    TEST_ASSERT_EQUAL_INT(3, ringbuffer_get_write_span(&buf, &wr));
+    TEST_ASSERT(wr == mem);
+    memcpy(wr, "fgh", 3);
+    ringbuffer_commit(&buf, 3);
+    TEST_ASSERT_EQUAL_INT(0, ringbuffer_get_write_span(&buf, &wr));
+
+    /* data is split in [3..4] and [0..2] */
+    TEST_ASSERT_EQUAL_INT(2, ringbuffer_peek_read_span(&buf, &rd));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(rd, "de", 2));
+    ringbuffer_remove(&buf, 2);
+    TEST_ASSERT_EQUAL_INT(3, ringbuffer_peek_read_span(&buf, &rd));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(rd, "fgh", 3));
+    ringbuffer_remove(&buf, 3);
+    TEST_ASSERT_EQUAL_INT(0, ringbuffer_peek_read_span(&buf, &rd));
+}
+
 Test *tests_core_ringbuffer_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(tests_core_ringbuffer),
         new_TestFixture(tests_core_ringbuffer_remove),
         new_TestFixture(tests_core_ringbuffer_remove_underflow),
+        new_TestFixture(tests_core_ringbuffer_add_wrap),
+        new_TestFixture(tests_core_ringbuffer_spans),
     };
 
     EMB_UNIT_TESTCALLER(ringbuffer_tests, NULL, NULL, fixtures);
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/ipv6/dst_cache.h"
+#include "net/ipv6/addr.h"
+
+#include "tests-gnrc_ipv6_dst_cache.h"
+
+#define TEST_IFACE          (5U)
+
+static const ipv6_addr_t _dst = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    } };
+static const ipv6_addr_t _src = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x02,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02
+    } };
+
+static void _set_nce(gnrc_ipv6_nib_nc_t *nce, unsigned nud_state)
+{
+    memset(nce, 0, sizeof(*nce));
+    ipv6_addr_set_link_local_prefix(&nce->ipv6);
+    nce->ipv6.u8[15] = 0x01;
+    nce->l2addr[0] = 0xab;
+    nce->l2addr[1] = 0xcd;
+    nce->l2addr_len = 2;
+    nce->info = (TEST_IFACE << GNRC_IPV6_NIB_NC_INFO_IFACE_POS) | nud_state;
+}
+
+static void set_up(void)
+{
+    gnrc_ipv6_dst_cache_invalidate();
+}
+
+static void test_dst_cache_get__empty(void)
+{
+    gnrc_ipv6_dst_cache_stats_t before, after;
+
+    gnrc_ipv6_dst_cache_stats_get(&before);
+    TEST_ASSERT_NULL(gnrc_ipv6_dst_cache_get(&_dst, 0));
+    gnrc_ipv6_dst_cache_stats_get(&after);
+    TEST_ASSERT_EQUAL_INT(before.hits, after.hits);
+    TEST_ASSERT_EQUAL_INT(before.misses + 1, after.misses);
+}
+
+static void test_dst_cache_add__success(void)
+{
+    gnrc_ipv6_dst_cache_stats_t before, after;
+    gnrc_ipv6_dst_cache_t *entry;
+    gnrc_ipv6_nib_nc_t nce;
+
+    _set_nce(&nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE);
+    entry = gnrc_ipv6_dst_cache_add(&_dst, 0, &nce,
+                                    gnrc_ipv6_dst_cache_version());
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT(ipv6_addr_is_unspecified(&entry->src));
+    entry->src = _src;
+
+    gnrc_ipv6_dst_cache_stats_get(&before);
+    TEST_ASSERT(entry == gnrc_ipv6_dst_cache_get(&_dst, 0));
+    gnrc_ipv6_dst_cache_stats_get(&after);
+    TEST_ASSERT_EQUAL_INT(before.hits + 1, after.hits);
+    TEST_ASSERT_EQUAL_INT(before.misses, after.misses);
+    TEST_ASSERT(ipv6_addr_equal(&_dst, &entry->dst));
+    TEST_ASSERT(ipv6_addr_equal(&_src, &entry->src));
+    TEST_ASSERT(ipv6_addr_equal(&nce.ipv6, &entry->nce.ipv6));
+    TEST_ASSERT_EQUAL_INT(nce.l2addr_len, entry->nce.l2addr_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(nce.l2addr, entry->nce.l2addr,
+                                    nce.l2addr_len));
+    TEST_ASSERT_EQUAL_INT(TEST_IFACE, gnrc_ipv6_nib_nc_get_iface(&entry->nce));
+    /* entries are per requested interface */
+    TEST_ASSERT_NULL(gnrc_ipv6_dst_cache_get(&_dst, TEST_IFACE));
+}
+
+static void test_dst_cache_add__unmanaged(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+
+    _set_nce(&nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED);
+    TEST_ASSERT_NOT_NULL(gnrc_ipv6_dst_cache_add(&_dst, TEST_IFACE, &nce,
+                                                 gnrc_ipv6_dst_cache_version()));
+    TEST_ASSERT_NOT_NULL(gnrc_ipv6_dst_cache_get(&_dst, TEST_IFACE));
+    TEST_ASSERT_NULL(gnrc_ipv6_dst_cache_get(&_dst, 0));
+}
+
+static void test_dst_cache_add__stale(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+
+    _set_nce(&nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE);
+    TEST_ASSERT_NULL(gnrc_ipv6_dst_cache_add(&_dst, 0, &nce,
+                                             gnrc_ipv6_dst_cache_version()));
+    TEST_ASSERT_NULL(gnrc_ipv6_dst_cache_get(&_dst, 0));
+}
+
+static void test_dst_cache_add__changed_during_lookup(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    uint32_t version = gnrc_ipv6_dst_cache_version();
+
+    _set_nce(&nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE);
+    gnrc_ipv6_dst_cache_invalidate();
+    TEST_ASSERT_NOT_NULL(gnrc_ipv6_dst_cache_add(&_dst, 0, &nce, version));
+    TEST_ASSERT_NULL(gnrc_ipv6_dst_cache_get(&_dst, 0));
+}
+
+static void test_dst_cache_invalidate(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+
+    _set_nce(&nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE);
+    TEST_ASSERT_NOT_NULL(gnrc_ipv6_dst_cache_add(&_dst, 0, &nce,
+                                                 gnrc_ipv6_dst_cache_version()));
+    TEST_ASSERT_NOT_NULL(gnrc_ipv6_dst_cache_get(&_dst, 0));
+    gnrc_ipv6_dst_cache_invalidate();
+    TEST_ASSERT_NULL(gnrc_ipv6_dst_cache_get(&_dst, 0));
+}
+
+static void test_dst_cache_add__full(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    ipv6_addr_t dst = _dst;
+    unsigned found = 0;
+
+    _set_nce(&nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE);
+    for (unsigned i = 0; i <= CONFIG_GNRC_IPV6_DST_CACHE_SIZE; i++) {
+        dst.u8[15] = i;
+        TEST_ASSERT_NOT_NULL(gnrc_ipv6_dst_cache_add(&dst, 0, &nce,
+                                                     gnrc_ipv6_dst_cache_version()));
+    }
+    /* latest is always cached */
+    TEST_ASSERT_NOT_NULL(gnrc_ipv6_dst_cache_get(&dst, 0));
+    for (unsigned i = 0; i <= CONFIG_GNRC_IPV6_DST_CACHE_SIZE; i++) {
+        dst.u8[15] = i;
+        if (gnrc_ipv6_dst_cache_get(&dst, 0) != NULL) {
+            found++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_IPV6_DST_CACHE_SIZE, found);
+}
+
+static Test *tests_gnrc_ipv6_dst_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_dst_cache_get__empty),
+        new_TestFixture(test_dst_cache_add__success),
+        new_TestFixture(test_dst_cache_add__unmanaged),
+        new_TestFixture(test_dst_cache_add__stale),
+        new_TestFixture(test_dst_cache_add__changed_during_lookup),
+        new_TestFixture(test_dst_cache_invalidate),
+        new_TestFixture(test_dst_cache_add__full),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_ipv6_dst_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_ipv6_dst_cache_tests;
+}
+
+void tests_gnrc_ipv6_dst_cache(void)
+{
+    TESTS_RUN(tests_gnrc_ipv6_dst_cache_tests());
+}
+/** @} */
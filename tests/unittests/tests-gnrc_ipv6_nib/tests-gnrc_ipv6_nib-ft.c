@@ -639,6 +639,29 @@ static void test_nib_ft_del__success(void)
     TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL ,0, &iter_state, &fte));
 }
 
+/*
+ * Adds a route, adds it again and removes it.
+ * Expected result: adding the new route and removing it invalidate the IPv6
+ * destination cache, adding the same route again does not
+ */
+static void test_nib_ft__dst_cache(void)
+{
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+    uint32_t version = gnrc_ipv6_dst_cache_version();
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop, IFACE, 0));
+    TEST_ASSERT(version != gnrc_ipv6_dst_cache_version());
+    version = gnrc_ipv6_dst_cache_version();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(version, gnrc_ipv6_dst_cache_version());
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    TEST_ASSERT(version != gnrc_ipv6_dst_cache_version());
+}
+
 /**
  * Creates three default routes and removes the first one.
  * The prefix list is then iterated.
@@ -748,6 +771,7 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_add__success_dr),
         new_TestFixture(test_nib_ft_del__unknown),
         new_TestFixture(test_nib_ft_del__success),
+        new_TestFixture(test_nib_ft__dst_cache),
         /* most of gnrc_ipv6_nib_ft_iter() is tested during all the tests above */
         new_TestFixture(test_nib_ft_iter__empty_def_route_at_beginning),
         new_TestFixture(test_nib_ft_iter__empty_pref_route_in_the_middle),
@@ -198,6 +198,35 @@ static void test_nib_nc_del__success(void)
     TEST_ASSERT(!gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
 }
 
+/*
+ * Creates a neighbor cache entry, sets it again with the same and then with a
+ * different link-layer address, marks it reachable and removes it.
+ * Expected result: only the change of the link-layer address and the removal
+ * invalidate the IPv6 destination cache
+ */
+static void test_nib_nc__dst_cache(void)
+{
+    static const ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                             { .u64 = TEST_UINT64 } } };
+    uint8_t l2addr[] = L2ADDR;
+    uint32_t version;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&addr, IFACE, l2addr,
+                                                  sizeof(l2addr)));
+    version = gnrc_ipv6_dst_cache_version();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&addr, IFACE, l2addr,
+                                                  sizeof(l2addr)));
+    gnrc_ipv6_nib_nc_mark_reachable(&addr);
+    TEST_ASSERT_EQUAL_INT(version, gnrc_ipv6_dst_cache_version());
+    l2addr[7]++;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&addr, IFACE, l2addr,
+                                                  sizeof(l2addr)));
+    TEST_ASSERT(version != gnrc_ipv6_dst_cache_version());
+    version = gnrc_ipv6_dst_cache_version();
+    gnrc_ipv6_nib_nc_del(&addr, IFACE);
+    TEST_ASSERT(version != gnrc_ipv6_dst_cache_version());
+}
+
 /*
  * Creates a non-manual neighbor cache entry (as the NIB would create it on an
  * incoming NDP packet), sets it to UNREACHABLE and then calls
@@ -314,6 +343,7 @@ Test *tests_gnrc_ipv6_nib_nc_tests(void)
         new_TestFixture(test_nib_nc_set__success_duplicate),
         new_TestFixture(test_nib_nc_del__unknown),
         new_TestFixture(test_nib_nc_del__success),
+        new_TestFixture(test_nib_nc__dst_cache),
         new_TestFixture(test_nib_nc_mark_reachable__not_in_neighbor_cache),
         new_TestFixture(test_nib_nc_mark_reachable__unmanaged),
         new_TestFixture(test_nib_nc_mark_reachable__success),
@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "net/tcp.h"
+
+#include "include/gnrc_tcp_rcvbuf.h"
+
+#include "tests-gnrc_tcp_rcvbuf.h"
+
+#define TEST_ISN            (1000U)
+#define TEST_SACK_MAX       (CONFIG_GNRC_TCP_RCV_OOO_SIZE)
+
+static gnrc_tcp_tcb_t _tcb;
+
+/* the payload byte at sequence number seq */
+static inline uint8_t _data(uint32_t seq)
+{
+    return (uint8_t)seq;
+}
+
+/* adds a segment holding the sequence space [seq, seq + len) */
+static int _add(uint32_t seq, size_t len)
+{
+    gnrc_pktsnip_t *tcp, *pkt;
+    tcp_hdr_t *hdr;
+    int res;
+
+    tcp = gnrc_pktbuf_add(NULL, NULL, sizeof(tcp_hdr_t), GNRC_NETTYPE_TCP);
+    if (tcp == NULL) {
+        return -ENOBUFS;
+    }
+    hdr = tcp->data;
+    memset(hdr, 0, sizeof(tcp_hdr_t));
+    hdr->seq_num = byteorder_htonl(seq);
+    pkt = gnrc_pktbuf_add(tcp, NULL, len, GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(tcp);
+        return -ENOBUFS;
+    }
+    for (size_t i = 0; i < len; i++) {
+        ((uint8_t *)pkt->data)[i] = _data(seq + i);
+    }
+    res = _gnrc_tcp_rcvbuf_add(&_tcb, pkt, seq, len);
+    /* the receive buffer holds the segment itself, if it keeps it */
+    gnrc_pktbuf_release(pkt);
+    return res;
+}
+
+/* checks that the receive buffer holds [seq, seq + len) and empties it */
+static void _check_read(uint32_t seq, size_t len)
+{
+    uint8_t buf[32];
+
+    TEST_ASSERT(len <= sizeof(buf));
+    TEST_ASSERT_EQUAL_INT(len, ringbuffer_get(&_tcb.rcv_buf, (char *)buf,
+                                              sizeof(buf)));
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(_data(seq + i), buf[i]);
+    }
+}
+
+/* checks the SACK blocks reported for the kept segments */
+static void _check_sack(const uint32_t *exp, unsigned exp_num)
+{
+    uint32_t blocks[2 * TEST_SACK_MAX];
+
+    TEST_ASSERT_EQUAL_INT(exp_num,
+                          _gnrc_tcp_rcvbuf_ooo_get_sack(&_tcb, blocks,
+                                                        TEST_SACK_MAX));
+    for (unsigned i = 0; i < 2 * exp_num; i++) {
+        TEST_ASSERT_EQUAL_INT(exp[i], blocks[i]);
+    }
+}
+
+static void set_up(void)
+{
+    gnrc_tcp_tcb_init(&_tcb);
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_rcvbuf_get_buffer(&_tcb));
+    _tcb.rcv_nxt = TEST_ISN;
+}
+
+static void tear_down(void)
+{
+    _gnrc_tcp_rcvbuf_ooo_clear(&_tcb);
+    _gnrc_tcp_rcvbuf_release_buffer(&_tcb);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_rcvbuf_add__in_order(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN, 10));
+    TEST_ASSERT_EQUAL_INT(TEST_ISN + 10, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rcv_ooo_len);
+    _check_read(TEST_ISN, 10);
+}
+
+static void test_rcvbuf_add__trim_below_rcv_nxt(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN, 4));
+    /* only the last 6 bytes were not received before */
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN - 2, 12));
+    TEST_ASSERT_EQUAL_INT(TEST_ISN + 10, _tcb.rcv_nxt);
+    _check_read(TEST_ISN, 10);
+    /* completely received before */
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 2, 8));
+    TEST_ASSERT_EQUAL_INT(TEST_ISN + 10, _tcb.rcv_nxt);
+    TEST_ASSERT(ringbuffer_empty(&_tcb.rcv_buf));
+}
+
+static void test_rcvbuf_add__duplicate(void)
+{
+    static const uint32_t exp[] = { TEST_ISN + 10, TEST_ISN + 20 };
+
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 10, 10));
+    TEST_ASSERT_EQUAL_INT(-EEXIST, _add(TEST_ISN + 10, 10));
+    TEST_ASSERT_EQUAL_INT(-EEXIST, _add(TEST_ISN + 12, 4));
+    TEST_ASSERT_EQUAL_INT(1, _tcb.rcv_ooo_len);
+    TEST_ASSERT_EQUAL_INT(TEST_ISN, _tcb.rcv_nxt);
+    _check_sack(exp, 1);
+}
+
+static void test_rcvbuf_add__full_cover(void)
+{
+    static const uint32_t exp[] = { TEST_ISN + 8, TEST_ISN + 24 };
+
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 10, 4));
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 16, 4));
+    /* covers both kept segments, which are released */
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 8, 16));
+    TEST_ASSERT_EQUAL_INT(1, _tcb.rcv_ooo_len);
+    _check_sack(exp, 1);
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN, 8));
+    TEST_ASSERT_EQUAL_INT(TEST_ISN + 24, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rcv_ooo_len);
+    _check_read(TEST_ISN, 24);
+}
+
+static void test_rcvbuf_add__partial_overlap(void)
+{
+    static const uint32_t exp[] = { TEST_ISN + 10, TEST_ISN + 22 };
+
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 10, 6));
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 14, 8));
+    /* both are kept, but reported as a single block */
+    TEST_ASSERT_EQUAL_INT(2, _tcb.rcv_ooo_len);
+    _check_sack(exp, 1);
+    /* fill the gap: both are merged without duplicating the overlap */
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN, 10));
+    TEST_ASSERT_EQUAL_INT(TEST_ISN + 22, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rcv_ooo_len);
+    _check_read(TEST_ISN, 22);
+}
+
+static void test_rcvbuf_add__merge_after_gap(void)
+{
+    static const uint32_t exp[] = { TEST_ISN + 20, TEST_ISN + 24 };
+
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 4, 4));
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 20, 4));
+    /* fills the first gap only */
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN, 4));
+    TEST_ASSERT_EQUAL_INT(TEST_ISN + 8, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(1, _tcb.rcv_ooo_len);
+    _check_sack(exp, 1);
+    /* fills the second gap */
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 8, 12));
+    TEST_ASSERT_EQUAL_INT(TEST_ISN + 24, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rcv_ooo_len);
+    _check_sack(NULL, 0);
+    _check_read(TEST_ISN, 24);
+}
+
+static void test_rcvbuf_add__ooo_full(void)
+{
+    uint32_t exp[2 * CONFIG_GNRC_TCP_RCV_OOO_SIZE] = { TEST_ISN + 2, TEST_ISN + 3 };
+    unsigned i;
+
+    for (i = 0; i < CONFIG_GNRC_TCP_RCV_OOO_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 10 * (i + 1), 1));
+    }
+    /* needed after all kept segments */
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, _add(TEST_ISN + 10 * (i + 1), 1));
+    /* the last kept segment makes room */
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 2, 1));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_RCV_OOO_SIZE, _tcb.rcv_ooo_len);
+    for (i = 1; i < CONFIG_GNRC_TCP_RCV_OOO_SIZE; i++) {
+        exp[2 * i] = TEST_ISN + 10 * i;
+        exp[2 * i + 1] = TEST_ISN + 10 * i + 1;
+    }
+    _check_sack(exp, CONFIG_GNRC_TCP_RCV_OOO_SIZE);
+}
+
+static void test_rcvbuf_add__rcvbuf_full(void)
+{
+    size_t free_space = 8;
+    uint32_t seq = TEST_ISN;
+    const uint32_t exp[] = { seq + free_space, seq + 14 };
+
+    /* leave only a few bytes of free space in the receive buffer */
+    while (ringbuffer_get_free(&_tcb.rcv_buf) > free_space) {
+        ringbuffer_add_one(&_tcb.rcv_buf, 0);
+    }
+    TEST_ASSERT_EQUAL_INT(0, _add(seq + 4, 10));
+    TEST_ASSERT_EQUAL_INT(0, _add(seq, 4));
+    /* only part of the kept segment fits, the rest is kept */
+    TEST_ASSERT_EQUAL_INT(seq + free_space, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(1, _tcb.rcv_ooo_len);
+    TEST_ASSERT(ringbuffer_full(&_tcb.rcv_buf));
+    /* the block reported to the peer starts at rcv_nxt */
+    _check_sack(exp, 1);
+    /* merged once there is space again */
+    ringbuffer_remove(&_tcb.rcv_buf, GNRC_TCP_RCV_BUF_SIZE - free_space);
+    _gnrc_tcp_rcvbuf_ooo_merge(&_tcb);
+    TEST_ASSERT_EQUAL_INT(seq + 14, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rcv_ooo_len);
+    _check_read(seq, 14);
+}
+
+static void test_rcvbuf_ooo_get_sack__order(void)
+{
+    static const uint32_t exp[] = {
+        TEST_ISN + 20, TEST_ISN + 22,
+        TEST_ISN + 10, TEST_ISN + 12,
+        TEST_ISN + 30, TEST_ISN + 32,
+    };
+
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 30, 2));
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 10, 2));
+    TEST_ASSERT_EQUAL_INT(0, _add(TEST_ISN + 20, 2));
+    /* the block received last comes first, the others in sequence order */
+    _check_sack(exp, 3);
+}
+
+static Test *tests_gnrc_tcp_rcvbuf_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rcvbuf_add__in_order),
+        new_TestFixture(test_rcvbuf_add__trim_below_rcv_nxt),
+        new_TestFixture(test_rcvbuf_add__duplicate),
+        new_TestFixture(test_rcvbuf_add__full_cover),
+        new_TestFixture(test_rcvbuf_add__partial_overlap),
+        new_TestFixture(test_rcvbuf_add__merge_after_gap),
+        new_TestFixture(test_rcvbuf_add__ooo_full),
+        new_TestFixture(test_rcvbuf_add__rcvbuf_full),
+        new_TestFixture(test_rcvbuf_ooo_get_sack__order),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_tcp_rcvbuf_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gnrc_tcp_rcvbuf_tests;
+}
+
+void tests_gnrc_tcp_rcvbuf(void)
+{
+    TESTS_RUN(tests_gnrc_tcp_rcvbuf_tests());
+}
+/** @} */
@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,47 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void test_inet_csum__unaligned(void)
+{
+    /* source: https://www.cloudshark.org/captures/ea72fbab241b (No. 1) */
+    static const uint8_t data[] = {
+        0xc0, 0xa8, 0x01, 0x91, 0x4b, 0x4b, 0x4b, 0x4b, /* IPv4 source + dest*/
+        0xf6, 0xfb, 0x00, 0x35, 0x00, 0x27, 0xd1, 0xa2, /* UDP header */
+        0xa5, 0x6f, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, /* DNS payload */
+        0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x65, 0x73,
+        0x74, 0x2d, 0x69, 0x70, 0x76, 0x36, 0x03, 0x63,
+        0x6f, 0x6d, 0x00, 0x00, 0x01, 0x00, 0x01,
+    };
+    uint32_t buf[(sizeof(data) + 2 * sizeof(uint32_t)) / sizeof(uint32_t)];
+
+    /* the word-wise sum must not depend on the alignment of the buffer */
+    for (unsigned offset = 0; offset < 2 * sizeof(uint32_t); offset++) {
+        uint8_t *start = (uint8_t *)buf + offset;
+
+        memcpy(start, data, sizeof(data));
+        TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(17 + 39, start, sizeof(data)));
+    }
+}
+
+static void test_inet_csum__all_slices(void)
+{
+    /* source: http://en.wikipedia.org/w/index.php?title=IPv4_header_checksum&oldid=645516564
+     * but left checksum 0 */
+    static const uint8_t data[] = {
+        0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00,
+        0x40, 0x11, 0x00, 0x00, 0xc0, 0xa8, 0x00, 0x01,
+        0xc0, 0xa8, 0x00, 0xc7,
+    };
+
+    /* splitting the domain at any byte must give the same sum */
+    for (unsigned split = 0; split <= sizeof(data); split++) {
+        uint16_t sum = inet_csum_slice(0, data, split, 0);
+
+        sum = inet_csum_slice(sum, &data[split], sizeof(data) - split, split);
+        TEST_ASSERT_EQUAL_INT(0x479e, sum);
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +218,8 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__unaligned),
+        new_TestFixture(test_inet_csum__all_slices),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -162,6 +162,62 @@ static void test_add(void)
     }
 }
 
+static void test_add_get_wrap(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    /* move read and write position to the middle of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2,
+                          tsrb_add(&_tsrb, _io_buffer, BUFFER_SIZE / 2));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2, tsrb_drop(&_tsrb, BUFFER_SIZE));
+    /* both copies now wrap around the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[BUFFER_SIZE]);
+}
+
+static void test_spans(void)
+{
+    uint8_t *wr;
+    const uint8_t *rd;
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_peek_read_span(&_tsrb, &rd));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get_write_span(&_tsrb, &wr));
+    TEST_ASSERT(wr == _tsrb_buffer);
+    memset(wr, TEST_INPUT, BUFFER_SIZE - TEST_DROP_NUM);
+    tsrb_commit(&_tsrb, BUFFER_SIZE - TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, tsrb_avail(&_tsrb));
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_peek_read_span(&_tsrb, &rd));
+    TEST_ASSERT(rd == _tsrb_buffer);
+    tsrb_consume(&_tsrb, BUFFER_SIZE - TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+
+    /* free space wraps around: it is split in two spans */
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_get_write_span(&_tsrb, &wr));
+    TEST_ASSERT(wr == &_tsrb_buffer[BUFFER_SIZE - TEST_DROP_NUM]);
+    memset(wr, TEST_INPUT, TEST_DROP_NUM);
+    tsrb_commit(&_tsrb, TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_get_write_span(&_tsrb, &wr));
+    TEST_ASSERT(wr == _tsrb_buffer);
+    tsrb_commit(&_tsrb, 1);
+
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_peek_read_span(&_tsrb, &rd));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, rd[0]);
+    tsrb_consume(&_tsrb, TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_peek_read_span(&_tsrb, &rd));
+    TEST_ASSERT(rd == _tsrb_buffer);
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -174,6 +230,8 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_spans),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
@@ -284,6 +284,53 @@ static void test_ztimer_mock_is_set(void)
     TEST_ASSERT(!ztimer_is_set(z, &alarm2));
 }
 
+/**
+ * @brief   Testing ztimer_set_with_slack()
+ */
+static void test_ztimer_mock_set_with_slack(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+
+    uint32_t count = 0;
+    uint32_t count_slack = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm_slack = { .callback = cb_incr, .arg = &count_slack, };
+    ztimer_stats_t stats;
+
+    /* no other timer within the slack, behaves like ztimer_set() */
+    ztimer_set_with_slack(z, &alarm_slack, 100, 1000);
+    ztimer_mock_advance(&zmock, 100);       /* now = 100 */
+    TEST_ASSERT_EQUAL_INT(1, count_slack);
+
+    /* other timer is too late */
+    ztimer_set(z, &alarm, 1000);
+    ztimer_set_with_slack(z, &alarm_slack, 500, 399);
+    ztimer_mock_advance(&zmock, 500);       /* now = 600 */
+    TEST_ASSERT_EQUAL_INT(2, count_slack);
+    TEST_ASSERT_EQUAL_INT(0, count);
+
+    /* alarm_slack gets moved to the target of alarm */
+    ztimer_set_with_slack(z, &alarm_slack, 100, 400);
+    ztimer_mock_advance(&zmock, 499);       /* now = 1099 */
+    TEST_ASSERT_EQUAL_INT(2, count_slack);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);         /* now = 1100 */
+    TEST_ASSERT_EQUAL_INT(3, count_slack);
+    TEST_ASSERT_EQUAL_INT(1, count);
+
+    ztimer_stats_get(z, &stats);
+    TEST_ASSERT_EQUAL_INT(3, stats.wakeups);
+    TEST_ASSERT_EQUAL_INT(1, stats.avoided);
+    TEST_ASSERT_EQUAL_INT(1, stats.coalesced);
+
+    ztimer_stats_reset(z);
+    ztimer_stats_get(z, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.wakeups);
+}
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -294,6 +341,7 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_set32),
         new_TestFixture(test_ztimer_mock_set16),
         new_TestFixture(test_ztimer_mock_is_set),
+        new_TestFixture(test_ztimer_mock_set_with_slack),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2026 The RIOT Developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the binary heap timer queue of ztimer
+ *
+ * Every timer records the time it fired at. The mock clock is advanced one
+ * tick at a time, so a timer firing late or early is detected.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit.h"
+
+#define TIMERS_NUMOF    (16U)
+#define NOT_FIRED       (UINT32_MAX)
+
+typedef struct {
+    ztimer_t timer;
+    uint32_t fired_at;
+} test_timer_t;
+
+static ztimer_mock_t _zmock;
+static ztimer_clock_t *const _z = &_zmock.super;
+static test_timer_t _timers[TIMERS_NUMOF];
+static unsigned _order[TIMERS_NUMOF];
+static unsigned _fired;
+static uint32_t _now;
+
+static void _cb(void *arg)
+{
+    test_timer_t *t = arg;
+
+    /* every timer fires once */
+    TEST_ASSERT_EQUAL_INT(NOT_FIRED, t->fired_at);
+    t->fired_at = _now;
+    _order[_fired++] = t - _timers;
+}
+
+static void _advance(uint32_t ticks)
+{
+    while (ticks--) {
+        _now++;
+        ztimer_mock_advance(&_zmock, 1);
+    }
+}
+
+static void _set(unsigned idx, uint32_t val)
+{
+    ztimer_set(_z, &_timers[idx].timer, val);
+}
+
+static void _init(unsigned width)
+{
+    memset(_timers, 0, sizeof(_timers));
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _timers[i].timer.callback = _cb;
+        _timers[i].timer.arg = &_timers[i];
+        _timers[i].fired_at = NOT_FIRED;
+    }
+    _fired = 0;
+    _now = 0;
+    ztimer_mock_init(&_zmock, width);
+}
+
+static void _check_fired(unsigned idx, uint32_t at)
+{
+    TEST_ASSERT_EQUAL_INT(at, _timers[idx].fired_at);
+    TEST_ASSERT_EQUAL_INT(0, ztimer_is_set(_z, &_timers[idx].timer));
+}
+
+static void test_ztimer_heap_set(void)
+{
+    /* not in order of their deadlines, so the heap is rebalanced */
+    static const uint32_t vals[TIMERS_NUMOF] = {
+        50, 3, 170, 29, 8, 111, 64, 1, 97, 140, 12, 41, 200, 77, 5, 160
+    };
+
+    _init(32);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _set(i, vals[i]);
+        TEST_ASSERT(ztimer_is_set(_z, &_timers[i].timer));
+    }
+    _advance(200);
+    TEST_ASSERT_EQUAL_INT(TIMERS_NUMOF, _fired);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _check_fired(i, vals[i]);
+    }
+    for (unsigned i = 1; i < TIMERS_NUMOF; i++) {
+        TEST_ASSERT(vals[_order[i - 1]] < vals[_order[i]]);
+    }
+}
+
+static void test_ztimer_heap_remove(void)
+{
+    _init(32);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _set(i, 10 * (i + 1));
+    }
+    /* remove the earliest timer (the root), the latest one (a leaf) and
+     * some in between */
+    ztimer_remove(_z, &_timers[0].timer);
+    ztimer_remove(_z, &_timers[TIMERS_NUMOF - 1].timer);
+    ztimer_remove(_z, &_timers[5].timer);
+    ztimer_remove(_z, &_timers[6].timer);
+    /* removing a timer twice does nothing */
+    ztimer_remove(_z, &_timers[5].timer);
+    TEST_ASSERT_EQUAL_INT(0, ztimer_is_set(_z, &_timers[0].timer));
+    TEST_ASSERT_EQUAL_INT(0, ztimer_is_set(_z, &_timers[5].timer));
+
+    /* removing a timer after others fired */
+    _advance(25);
+    ztimer_remove(_z, &_timers[9].timer);
+
+    _advance(10 * TIMERS_NUMOF);
+    TEST_ASSERT_EQUAL_INT(TIMERS_NUMOF - 5, _fired);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        if ((i == 0) || (i == 5) || (i == 6) || (i == 9) || (i == TIMERS_NUMOF - 1)) {
+            TEST_ASSERT_EQUAL_INT(NOT_FIRED, _timers[i].fired_at);
+        }
+        else {
+            _check_fired(i, 10 * (i + 1));
+        }
+    }
+}
+
+static void test_ztimer_heap_reorder(void)
+{
+    _init(32);
+    for (unsigned i = 0; i < 8; i++) {
+        _set(i, 10 * (i + 1));
+    }
+    /* setting a set timer again moves it up and down the heap */
+    _set(7, 5);
+    _set(0, 100);
+    _set(3, 35);
+    _advance(15);
+    /* set relative to the current time */
+    _set(1, 3);
+    _advance(100);
+
+    TEST_ASSERT_EQUAL_INT(8, _fired);
+    _check_fired(7, 5);
+    _check_fired(0, 100);
+    _check_fired(1, 18);
+    _check_fired(3, 35);
+    for (unsigned i = 2; i < 7; i++) {
+        if (i != 3) {
+            _check_fired(i, 10 * (i + 1));
+        }
+    }
+}
+
+static void test_ztimer_heap_equal(void)
+{
+    _init(32);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _set(i, (i % 2) ? 42 : 17);
+    }
+    _advance(16);
+    TEST_ASSERT_EQUAL_INT(0, _fired);
+    _advance(1);
+    TEST_ASSERT_EQUAL_INT(TIMERS_NUMOF / 2, _fired);
+    _advance(24);
+    TEST_ASSERT_EQUAL_INT(TIMERS_NUMOF / 2, _fired);
+    _advance(1);
+    TEST_ASSERT_EQUAL_INT(TIMERS_NUMOF, _fired);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _check_fired(i, (i % 2) ? 42 : 17);
+    }
+}
+
+static void test_ztimer_heap_wraparound16(void)
+{
+    _init(16);
+    /* the counter wraps after each of these */
+    _advance(0xff00);
+    _set(0, 0x80);
+    _set(1, 0x100);
+    _set(2, 0x200);
+    _set(3, 0x12345);
+    _set(4, 0x10);
+    _advance(0x12345);
+
+    TEST_ASSERT_EQUAL_INT(5, _fired);
+    _check_fired(4, 0xff00 + 0x10);
+    _check_fired(0, 0xff00 + 0x80);
+    _check_fired(1, 0xff00 + 0x100);
+    _check_fired(2, 0xff00 + 0x200);
+    _check_fired(3, 0xff00 + 0x12345);
+}
+
+static void test_ztimer_heap_wraparound32(void)
+{
+    _init(32);
+    /* targets on both sides of the 32 bit wrap */
+    ztimer_mock_jump(&_zmock, 0xffffff00ul);
+    _set(0, 0x200);
+    _set(1, 0x80);
+    _set(2, 0x100);
+    _set(3, 0xff);
+    _advance(0x200);
+
+    TEST_ASSERT_EQUAL_INT(4, _fired);
+    _check_fired(1, 0x80);
+    _check_fired(3, 0xff);
+    _check_fired(2, 0x100);
+    _check_fired(0, 0x200);
+    TEST_ASSERT_EQUAL_INT(1, _order[0]);
+    TEST_ASSERT_EQUAL_INT(3, _order[1]);
+    TEST_ASSERT_EQUAL_INT(2, _order[2]);
+    TEST_ASSERT_EQUAL_INT(0, _order[3]);
+}
+
+Test *tests_ztimer_heap(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_heap_set),
+        new_TestFixture(test_ztimer_heap_remove),
+        new_TestFixture(test_ztimer_heap_reorder),
+        new_TestFixture(test_ztimer_heap_equal),
+        new_TestFixture(test_ztimer_heap_wraparound16),
+        new_TestFixture(test_ztimer_heap_wraparound32),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_heap_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_heap_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_ztimer_heap());
+    TESTS_END();
+    return 0;
+}